@@ -44,7 +44,10 @@ _centerPitchWheelOnUnload(false),
 _sendSustainOffOnNotesOff(false),
 _numTracks(0),
 _activeTrack(255),
-_abortParse(0) {
+_abortParse(0),
+_useSeekIndex(false),
+_seekIndexTrack(0),
+_seekIndexTempoTick(0xFFFFFFFF) {
 	memset(_activeNotes, 0, sizeof(_activeNotes));
 	_nextEvent.start = NULL;
 	_nextEvent.delta = 0;
@@ -53,6 +56,9 @@ _abortParse(0) {
 }
 
 void MidiParser::property(int prop, int value) {
+	// Properties may change how the track is parsed
+	invalidateSeekIndex();
+
 	switch (prop) {
 	case mpAutoLoop:
 		_autoLoop = (value != 0);
@@ -372,10 +378,22 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 	Tracker currentPos(_position);
 	EventInfo currentEvent(_nextEvent);
 
+	if (_useSeekIndex && _seekIndexTrack != _tracks[_activeTrack]) {
+		invalidateSeekIndex();
+		_seekIndexTrack = _tracks[_activeTrack];
+	}
+	const uint32 startPsecPerTick = _psecPerTick;
+
 	resetTracking();
 	_position._playPos = _tracks[_activeTrack];
 	parseNextEvent(_nextEvent);
 	if (tick > 0) {
+		uint32 eventCount = 0;
+
+		// Events are only skipped if they would not be sent anyway
+		if (_useSeekIndex && !fireEvents)
+			eventCount = seekFromIndex(tick, startPsecPerTick);
+
 		while (true) {
 			EventInfo &info = _nextEvent;
 			if (_position._lastEventTick + info.delta >= tick) {
@@ -395,8 +413,11 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 					_nextEvent = currentEvent;
 					return false;
 				} else {
-					if (info.ext.type == 0x51 && info.length >= 3) // Tempo
+					if (info.ext.type == 0x51 && info.length >= 3) { // Tempo
 						setTempo(info.ext.data[0] << 16 | info.ext.data[1] << 8 | info.ext.data[2]);
+						if (_position._lastEventTick < _seekIndexTempoTick)
+							_seekIndexTempoTick = _position._lastEventTick;
+					}
 					if (fireEvents)
 						_driver->metaEvent(info.ext.type, info.ext.data, (uint16) info.length);
 				}
@@ -420,6 +441,9 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 			}
 
 			parseNextEvent(_nextEvent);
+
+			if (_useSeekIndex && ++eventCount % kSeekIndexInterval == 0)
+				addSeekCheckpoint(eventCount / kSeekIndexInterval, startPsecPerTick);
 		}
 	}
 
@@ -443,7 +467,61 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 	return true;
 }
 
+void MidiParser::invalidateSeekIndex() {
+	_seekIndex.clear();
+	_seekIndexTrack = 0;
+	_seekIndexTempoTick = 0xFFFFFFFF;
+}
+
+uint32 MidiParser::seekFromIndex(uint32 tick, uint32 startPsecPerTick) {
+	// Find the last checkpoint before the one whose next event is
+	// at or after the target tick
+	uint lo = 0, hi = _seekIndex.size();
+	while (lo < hi) {
+		const uint mid = (lo + hi) / 2;
+		const SeekCheckpoint &checkpoint = _seekIndex[mid];
+		if (checkpoint.position._lastEventTick + checkpoint.nextEvent.delta < tick)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (!lo)
+		return 0;
+
+	const SeekCheckpoint &checkpoint = _seekIndex[lo - 1];
+	_position = checkpoint.position;
+	_nextEvent = checkpoint.nextEvent;
+	loadSeekState(lo - 1);
+
+	if (checkpoint.tempoChanged) {
+		_tempo = checkpoint.tempo;
+		_psecPerTick = checkpoint.psecPerTick;
+	}
+
+	_position._lastEventTime += MIN(_position._lastEventTick, _seekIndexTempoTick) * startPsecPerTick;
+	_position._playTime = _position._lastEventTime;
+	return lo * kSeekIndexInterval;
+}
+
+void MidiParser::addSeekCheckpoint(uint32 count, uint32 startPsecPerTick) {
+	// Checkpoints are only added in order, past the end of the index
+	if (count != _seekIndex.size() + 1 || !saveSeekState(_seekIndex.size()))
+		return;
+
+	SeekCheckpoint checkpoint;
+	checkpoint.position = _position;
+	checkpoint.nextEvent = _nextEvent;
+	checkpoint.tempo = _tempo;
+	checkpoint.psecPerTick = _psecPerTick;
+	checkpoint.tempoChanged = _seekIndexTempoTick != 0xFFFFFFFF;
+	checkpoint.position._lastEventTime -= MIN(_position._lastEventTick, _seekIndexTempoTick) * startPsecPerTick;
+	checkpoint.position._playTime = checkpoint.position._lastEventTime;
+	_seekIndex.push_back(checkpoint);
+}
+
 void MidiParser::unloadMusic() {
+	invalidateSeekIndex();
 	resetTracking();
 	allNotesOff();
 	_numTracks = 0;
@@ -26,6 +26,7 @@
 #define AUDIO_MIDIPARSER_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/endian.h"
 
 class MidiDriver_BASE;
@@ -288,6 +289,32 @@ protected:
 	                        ///< simulated events in certain formats.
 	bool   _abortParse;    ///< If a jump or other operation interrupts parsing, flag to abort.
 
+	/**
+	 * The parser state after a multiple of kSeekIndexInterval events
+	 * of the active track have been parsed. Used by jumpToTick to
+	 * skip ahead instead of parsing the track from its start.
+	 *
+	 * The time spent before the first tempo event of the track depends
+	 * on the tempo the track is started with. It is left out of the
+	 * stored times and added back when the checkpoint is used.
+	 */
+	struct SeekCheckpoint {
+		Tracker position;
+		EventInfo nextEvent;
+		uint32 tempo;
+		uint32 psecPerTick;
+		bool tempoChanged; ///< Whether a tempo event was parsed before the checkpoint.
+	};
+
+	enum {
+		kSeekIndexInterval = 256
+	};
+
+	bool   _useSeekIndex;  ///< Set by formats which can resume parsing from a checkpoint.
+	Common::Array<SeekCheckpoint> _seekIndex; ///< Checkpoints of the active track, in order.
+	byte  *_seekIndexTrack; ///< The track _seekIndex was built for.
+	uint32 _seekIndexTempoTick; ///< The tick of the first tempo event of the track, if already known.
+
 protected:
 	static uint32 readVLQ(byte * &data);
 	virtual void resetTracking();
@@ -298,6 +325,20 @@ protected:
 	void hangingNote(byte channel, byte note, uint32 ticksLeft, bool recycle = true);
 	void hangAllActiveNotes();
 
+	void invalidateSeekIndex();
+	uint32 seekFromIndex(uint32 tick, uint32 startPsecPerTick);
+	void addSeekCheckpoint(uint32 count, uint32 startPsecPerTick);
+
+	/**
+	 * Formats whose parseNextEvent keeps state of its own store it for
+	 * the given checkpoint here. Returning false means that resuming
+	 * from this point would skip side effects, so no further checkpoints
+	 * are added for the track.
+	 */
+	virtual bool saveSeekState(uint index) { return true; }
+	/** Restores the state stored by saveSeekState for the given checkpoint. */
+	virtual void loadSeekState(uint index) {}
+
 	virtual void sendToDriver(uint32 b);
 	void sendToDriver(byte status, byte firstOp, byte secondOp) {
 		sendToDriver(status | ((uint32)firstOp << 8) | ((uint32)secondOp << 16));
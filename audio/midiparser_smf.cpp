@@ -37,7 +37,7 @@ protected:
 	void parseNextEvent(EventInfo &info);
 
 public:
-	MidiParser_SMF() : _buffer(0), _malformedPitchBends(false) {}
+	MidiParser_SMF() : _buffer(0), _malformedPitchBends(false) { _useSeekIndex = true; }
 	~MidiParser_SMF();
 
 	bool loadMusic(byte *data, uint32 size);
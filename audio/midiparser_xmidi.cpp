@@ -42,13 +42,27 @@ protected:
 
 	XMidiCallbackProc _callbackProc;
 	void *_callbackData;
+	bool _callbackTriggered; ///< Whether a callback was triggered since the start of the track.
+
+	/** The loop state of each seek checkpoint. */
+	struct LoopState {
+		Loop loop[4];
+		int loopCount;
+	};
+
+	Common::Array<LoopState> _seekLoopStates;
 
 protected:
 	uint32 readVLQ2(byte * &data);
+	void resetTracking();
 	void parseNextEvent(EventInfo &info);
+	bool saveSeekState(uint index);
+	void loadSeekState(uint index);
 
 public:
-	MidiParser_XMIDI(XMidiCallbackProc proc, void *data) : _callbackProc(proc), _callbackData(data) {}
+	MidiParser_XMIDI(XMidiCallbackProc proc, void *data) : _loopCount(-1), _callbackProc(proc), _callbackData(data), _callbackTriggered(false) {
+		_useSeekIndex = true;
+	}
 	~MidiParser_XMIDI() { }
 
 	bool loadMusic(byte *data, uint32 size);
@@ -64,6 +78,33 @@ uint32 MidiParser_XMIDI::readVLQ2(byte * &pos) {
 	return value;
 }
 
+void MidiParser_XMIDI::resetTracking() {
+	MidiParser::resetTracking();
+
+	// The loop stack points into the current track
+	_loopCount = -1;
+	_callbackTriggered = false;
+}
+
+bool MidiParser_XMIDI::saveSeekState(uint index) {
+	// Seeking past the checkpoint would not trigger the callbacks before it
+	if (_callbackTriggered)
+		return false;
+
+	LoopState state;
+	memcpy(state.loop, _loop, sizeof(_loop));
+	state.loopCount = _loopCount;
+
+	_seekLoopStates.resize(index);
+	_seekLoopStates.push_back(state);
+	return true;
+}
+
+void MidiParser_XMIDI::loadSeekState(uint index) {
+	memcpy(_loop, _seekLoopStates[index].loop, sizeof(_loop));
+	_loopCount = _seekLoopStates[index].loopCount;
+}
+
 void MidiParser_XMIDI::parseNextEvent(EventInfo &info) {
 	info.start = _position._playPos;
 	info.delta = readVLQ2(_position._playPos);
@@ -135,8 +176,10 @@ void MidiParser_XMIDI::parseNextEvent(EventInfo &info) {
 			break;
 
 		case 0x77:	// XMIDI_CONTROLLER_CALLBACK_TRIG
-			if (_callbackProc)
+			if (_callbackProc) {
 				_callbackProc(info.basic.param2, _callbackData);
+				_callbackTriggered = true;
+			}
 			break;
 
 		case 0x6e:	// XMIDI_CONTROLLER_CHAN_LOCK
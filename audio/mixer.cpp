@@ -21,6 +21,7 @@
  */
 
 #include "common/util.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -267,6 +268,8 @@ void MixerImpl::playStream(
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
+	PROFILE_ZONE_TRACK("mixer", Common::kProfileTrackAudio);
+
 	Common::StackLock lock(_mutex);
 
 	int16 *buf = (int16 *)samples;
@@ -266,8 +266,14 @@ unsigned long Partial::generateSamples(float *partialBuf, unsigned long length)
 			}
 
 			float newPCMPosition = pcmPosition + positionDelta;
-			if (pcmWave->loop) {
-				newPCMPosition = fmod(newPCMPosition, (float)pcmWave->len);
+			if (pcmWave->loop && newPCMPosition >= len) {
+				// Avoid the costly fmod() in the common case of wrapping around
+				// once. The subtraction is exact there, so the result is the same.
+				if (newPCMPosition < 2.0f * len) {
+					newPCMPosition -= len;
+				} else {
+					newPCMPosition = fmod(newPCMPosition, (float)len);
+				}
 			}
 			pcmPosition = newPCMPosition;
 		} else {
@@ -575,16 +581,15 @@ bool Partial::produceOutput(float *leftBuf, float *rightBuf, unsigned long lengt
 		}
 	}
 
+	// Mix straight into the output buffers. These are simple loops over
+	// contiguous buffers, which compilers are able to vectorise.
+	const float leftVol = stereoVolume.leftVol;
+	const float rightVol = stereoVolume.rightVol;
 	for (unsigned int i = 0; i < numGenerated; i++) {
-		*leftBuf++ = partialBuf[i] * stereoVolume.leftVol;
+		leftBuf[i] += partialBuf[i] * leftVol;
 	}
 	for (unsigned int i = 0; i < numGenerated; i++) {
-		*rightBuf++ = partialBuf[i] * stereoVolume.rightVol;
-	}
-	while (numGenerated < length) {
-		*leftBuf++ = 0.0f;
-		*rightBuf++ = 0.0f;
-		numGenerated++;
+		rightBuf[i] += partialBuf[i] * rightVol;
 	}
 	return true;
 }
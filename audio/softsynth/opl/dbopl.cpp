@@ -435,6 +435,9 @@ static const VolumeHandler VolumeHandlerTable[5] = {
 };
 
 INLINE Bitu Operator::ForwardVolume() {
+	//Skip the volume handler when it would only return the current volume
+	if ( staticVolume )
+		return currentLevel + volume;
 	return currentLevel + (this->*volHandler)();
 }
 
@@ -531,6 +534,9 @@ INLINE bool Operator::Silent() const {
 
 INLINE void Operator::Prepare( const Chip* chip )  {
 	currentLevel = totalLevel + (chip->tremoloValue & tremoloMask);
+	//Finished and sustained envelopes only change with register writes,
+	//which never happen during a block. An OFF envelope is at ENV_MAX.
+	staticVolume = state == OFF || ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) );
 	waveCurrent = waveAdd;
 	if ( vibStrength >> chip->vibratoShift ) {
 		Bit32s add = vibrato >> chip->vibratoShift;
@@ -610,6 +616,7 @@ Operator::Operator() {
 	regE0 = 0;
 	SetState( OFF );
 	rateZero = (1 << OFF);
+	staticVolume = false;
 	sustainLevel = ENV_MAX;
 	currentLevel = ENV_MAX;
 	totalLevel = ENV_MAX;
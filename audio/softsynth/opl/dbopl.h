@@ -136,6 +136,7 @@ public:
 	Bit32u rateIndex;			//Current position of the evenlope
 
 	Bit8u rateZero;				//Bits for the different states of the envelope having no changes
+	bool staticVolume;			//The envelope can't change during the current block
 	Bit8u keyOn;				//Bitmask of different values that can generate keyon
 	//Registers, also used to check for changes
 	Bit8u reg20, reg40, reg60, reg80, regE0;
@@ -28,6 +28,7 @@
 #include "backends/mutex/mutex.h"
 
 #include "audio/mixer.h"
+#include "common/profiler.h"
 #include "graphics/pixelformat.h"
 
 ModularBackend::ModularBackend()
@@ -141,6 +142,9 @@ void ModularBackend::fillScreen(uint32 col) {
 }
 
 void ModularBackend::updateScreen() {
+	PROFILE_FRAME();
+	PROFILE_ZONE("updateScreen");
+
 	_graphicsManager->updateScreen();
 }
 
@@ -20,15 +20,35 @@
  *
  */
 
+#define FORBIDDEN_SYMBOL_EXCEPTION_FILE
+#define FORBIDDEN_SYMBOL_EXCEPTION_stdout
+#define FORBIDDEN_SYMBOL_EXCEPTION_stderr
+#define FORBIDDEN_SYMBOL_EXCEPTION_fputs
+#define FORBIDDEN_SYMBOL_EXCEPTION_fflush
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+#define FORBIDDEN_SYMBOL_EXCEPTION_unistd_h
+
 #include "backends/modular-backend.h"
 #include "base/main.h"
 
 #if defined(USE_NULL_DRIVER)
+#include "backends/mutex/null/null-mutex.h"
+#include "backends/graphics/null/null-graphics.h"
+#include "backends/events/default/default-events.h"
 #include "backends/saves/default/default-saves.h"
 #include "backends/timer/default/default-timer.h"
 #include "audio/mixer_intern.h"
+#include "common/config-manager.h"
+#include "common/EventRecorder.h"
+#include "common/savefile.h"
 #include "common/scummsys.h"
 
+#if defined(POSIX)
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
 /*
  * Include header files needed for the getFilesystemFactory() method.
  */
@@ -40,7 +60,7 @@
 	#include "backends/fs/windows/windows-fs-factory.h"
 #endif
 
-class OSystem_NULL : public ModularBackend {
+class OSystem_NULL : public ModularBackend, Common::EventSource {
 public:
 	OSystem_NULL();
 	virtual ~OSystem_NULL();
@@ -48,15 +68,51 @@ public:
 	virtual void initBackend();
 
 	virtual bool pollEvent(Common::Event &event);
+	virtual Common::EventSource *getDefaultEventSource() { return this; }
+
+	virtual void updateScreen();
 
 	virtual uint32 getMillis();
 	virtual void delayMillis(uint msecs);
+	virtual uint32 getMicros();
 	virtual void getTimeAndDate(TimeDate &t) const {}
 
 	virtual void logMessage(LogMessageType::Type type, const char *message);
+
+private:
+	enum {
+		kSampleRate = 22050,
+		kMixBufferSamples = 2048
+	};
+
+	/** Feeds the mixer with the samples for the time elapsed since the last call */
+	void mixAudio();
+
+	void startBenchmark();
+	void endBenchmark();
+
+	/** Peak resident memory of the process in KB, or 0 if unknown */
+	uint32 getPeakMemory() const;
+
+#if defined(POSIX)
+	timeval _startTime;
+#endif
+
+	uint32 _lastMillis;
+	uint32 _lastMixMillis;
+	bool _mixing;
+	int16 _mixBuffer[kMixBufferSamples * 2];
+
+	Common::WriteStream *_benchmarkFile;
+	uint32 _benchmarkFrame;
+	uint32 _frameEndMicros;
 };
 
-OSystem_NULL::OSystem_NULL() {
+OSystem_NULL::OSystem_NULL() : _lastMillis(0), _lastMixMillis(0), _mixing(false), _benchmarkFile(0), _benchmarkFrame(0), _frameEndMicros(0) {
+#if defined(POSIX)
+	gettimeofday(&_startTime, 0);
+#endif
+
 	#if defined(__amigaos4__)
 		_fsFactory = new AmigaOSFilesystemFactory();
 	#elif defined(POSIX)
@@ -69,6 +125,7 @@ OSystem_NULL::OSystem_NULL() {
 }
 
 OSystem_NULL::~OSystem_NULL() {
+	endBenchmark();
 }
 
 void OSystem_NULL::initBackend() {
@@ -77,13 +134,14 @@ void OSystem_NULL::initBackend() {
 	_eventManager = new DefaultEventManager(this);
 	_savefileManager = new DefaultSaveFileManager();
 	_graphicsManager = new NullGraphicsManager();
-	_mixer = new Audio::MixerImpl(this, 22050);
+	_mixer = new Audio::MixerImpl(this, kSampleRate);
 
-	((Audio::MixerImpl *)_mixer)->setReady(false);
+	// The mixer is fed from updateScreen() and its output is thrown away.
+	((Audio::MixerImpl *)_mixer)->setReady(true);
 
-	// Note that both the mixer and the timer manager are useless
-	// this way; they need to be hooked into the system somehow to
-	// be functional. Of course, can't do that in a NULL backend :).
+	// Note that the timer manager is useless this way; it needs to
+	// be hooked into the system somehow to be functional. Of course,
+	// can't do that in a NULL backend :).
 
 	ModularBackend::initBackend();
 }
@@ -92,11 +150,119 @@ bool OSystem_NULL::pollEvent(Common::Event &event) {
 	return false;
 }
 
+void OSystem_NULL::updateScreen() {
+	if (!_benchmarkFile && g_eventRec.isBenchmarking())
+		startBenchmark();
+
+	const uint32 frameStart = getMicros();
+	ModularBackend::updateScreen();
+	const uint32 screenEnd = getMicros();
+	mixAudio();
+	const uint32 mixerEnd = getMicros();
+
+	if (_benchmarkFile) {
+		// Everything between two screen updates is accounted to the engine
+		_benchmarkFile->writeString(Common::String::format("%u,%u,%u,%u,%u,%u\n",
+			_benchmarkFrame, _lastMillis, frameStart - _frameEndMicros,
+			screenEnd - frameStart, mixerEnd - screenEnd, getPeakMemory()));
+		++_benchmarkFrame;
+	}
+
+	_frameEndMicros = getMicros();
+}
+
+void OSystem_NULL::mixAudio() {
+	// Only mix up to the time last seen by the engine; querying the time
+	// here would use up recorded time during playback.
+	const uint32 millis = _lastMillis;
+	uint32 samples = (millis - _lastMixMillis) * kSampleRate / 1000;
+	_lastMixMillis = millis;
+
+	// The mixer queries the time as well, make it see the same time.
+	_mixing = true;
+	while (samples > 0) {
+		const uint32 len = MIN<uint32>(samples, kMixBufferSamples);
+		((Audio::MixerImpl *)_mixer)->mixCallback((byte *)_mixBuffer, len * 4);
+		samples -= len;
+	}
+	_mixing = false;
+}
+
+void OSystem_NULL::startBenchmark() {
+	const Common::String fileName = ConfMan.get("record_benchmark_file_name");
+	_benchmarkFile = _savefileManager->openForSaving(fileName, false);
+	if (!_benchmarkFile) {
+		warning("Cannot open benchmark file %s", fileName.c_str());
+		return;
+	}
+
+	_benchmarkFile->writeString("frame,millis,engine_us,screen_us,mixer_us,peak_memory_kb\n");
+	_benchmarkFrame = 0;
+	_frameEndMicros = getMicros();
+}
+
+void OSystem_NULL::endBenchmark() {
+	if (!_benchmarkFile)
+		return;
+
+	_benchmarkFile->finalize();
+	if (_benchmarkFile->err())
+		warning("Writing the benchmark file failed");
+	delete _benchmarkFile;
+	_benchmarkFile = 0;
+}
+
 uint32 OSystem_NULL::getMillis() {
-	return 0;
+	if (_mixing)
+		return _lastMillis;
+
+#if defined(POSIX)
+	timeval curTime;
+	gettimeofday(&curTime, 0);
+
+	uint32 millis = (uint32)(((curTime.tv_sec - _startTime.tv_sec) * 1000) +
+			((curTime.tv_usec - _startTime.tv_usec) / 1000));
+#else
+	uint32 millis = 0;
+#endif
+
+	g_eventRec.processMillis(millis);
+	_lastMillis = millis;
+	return millis;
 }
 
 void OSystem_NULL::delayMillis(uint msecs) {
+	if (g_eventRec.processDelayMillis(msecs))
+		return;
+
+#if defined(POSIX)
+	usleep(msecs * 1000);
+#endif
+}
+
+uint32 OSystem_NULL::getMicros() {
+#if defined(POSIX)
+	timeval curTime;
+	gettimeofday(&curTime, 0);
+
+	return (uint32)((curTime.tv_sec - _startTime.tv_sec) * 1000000 + (curTime.tv_usec - _startTime.tv_usec));
+#else
+	return 0;
+#endif
+}
+
+uint32 OSystem_NULL::getPeakMemory() const {
+#if defined(POSIX)
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(MACOSX)
+		return usage.ru_maxrss / 1024;
+#else
+		return usage.ru_maxrss;
+#endif
+	}
+#endif
+	return 0;
 }
 
 void OSystem_NULL::logMessage(LogMessageType::Type type, const char *message) {
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
@@ -73,6 +74,14 @@ void OSystem_POSIX::initBackend() {
 #endif
 }
 
+uint32 OSystem_POSIX::getMicros() {
+	// Only differences between timestamps matter, so wrapping is fine
+	timeval curTime;
+	gettimeofday(&curTime, 0);
+
+	return (uint32)(curTime.tv_sec * 1000000 + curTime.tv_usec);
+}
+
 bool OSystem_POSIX::hasFeature(Feature f) {
 	if (f == kFeatureDisplayLogFile)
 		return true;
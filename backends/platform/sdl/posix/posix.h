@@ -38,6 +38,8 @@ public:
 	virtual void init();
 	virtual void initBackend();
 
+	virtual uint32 getMicros();
+
 protected:
 	/**
 	 * Base string for creating the default path and filename for the
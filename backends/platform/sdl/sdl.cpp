@@ -477,6 +477,19 @@ void OSystem_SDL::delayMillis(uint msecs) {
 		SDL_Delay(msecs);
 }
 
+uint32 OSystem_SDL::getMicros() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Split the conversion so that it doesn't overflow for large counter
+	// values. Only differences between timestamps matter, so wrapping is fine
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	const Uint64 counter = SDL_GetPerformanceCounter();
+	return (uint32)((counter / frequency) * 1000000 + (counter % frequency) * 1000000 / frequency);
+#else
+	// SDL 1.2 has no timer with a better than millisecond precision
+	return SDL_GetTicks() * 1000;
+#endif
+}
+
 void OSystem_SDL::getTimeAndDate(TimeDate &td) const {
 	time_t curTime = time(0);
 	struct tm t = *localtime(&curTime);
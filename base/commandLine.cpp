@@ -136,6 +136,11 @@ static const char HELP_STRING[] =
 	"  --dimuse-tempo=NUM       Set internal Digital iMuse tempo (10 - 100) per second\n"
 	"                           (default: 10)\n"
 #endif
+#endif
+#ifdef USE_FRAME_PROFILER
+	"  --profiler-trace-file=FILE Write frame profiler zones to FILE in the\n"
+	"                           Chrome trace-event format\n"
+	"  --profiler-osd           Show the frame profiler zones on screen\n"
 #endif
 	"\n"
 	"The meaning of boolean long options can be inverted by prefixing them with\n"
@@ -236,6 +241,12 @@ void registerDefaults() {
 	ConfMan.registerDefault("record_file_name", "record.bin");
 	ConfMan.registerDefault("record_temp_file_name", "record.tmp");
 	ConfMan.registerDefault("record_time_file_name", "record.time");
+	ConfMan.registerDefault("record_benchmark_file_name", "benchmark.csv");
+
+#ifdef USE_FRAME_PROFILER
+	ConfMan.registerDefault("profiler_trace_file", "");
+	ConfMan.registerDefault("profiler_osd", false);
+#endif
 
 	ConfMan.registerDefault("gui_saveload_chooser", "grid");
 	ConfMan.registerDefault("gui_saveload_last_pos", "0");
@@ -575,6 +586,17 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION("record-time-file-name")
 			END_OPTION
 
+			DO_LONG_OPTION("record-benchmark-file-name")
+			END_OPTION
+
+#ifdef USE_FRAME_PROFILER
+			DO_LONG_OPTION("profiler-trace-file")
+			END_OPTION
+
+			DO_LONG_OPTION_BOOL("profiler-osd")
+			END_OPTION
+#endif
+
 #ifdef IPHONE
 			// This is automatically set when launched from the Springboard.
 			DO_LONG_OPTION_OPT("launchedFromSB", 0)
@@ -44,6 +44,7 @@
 #include "common/events.h"
 #include "common/EventRecorder.h"
 #include "common/fs.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/tokenizer.h"
@@ -430,6 +431,10 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	// the whole API for that ;-).
 	g_eventRec.init();
 
+#ifdef USE_FRAME_PROFILER
+	Common::FrameProfiler::instance().init();
+#endif
+
 	// Now as the event manager is created, setup the keymapper
 	setupKeymapper(system);
 
@@ -496,6 +501,11 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 		setupGraphics(system);
 		launcherDialog();
 	}
+#ifdef USE_FRAME_PROFILER
+	// Write the trace. The profiler itself stays around, as the mixer may
+	// still be running.
+	Common::FrameProfiler::instance().deinit();
+#endif
 	PluginManager::instance().unloadAllPlugins();
 	PluginManager::destroy();
 	GUI::GuiManager::destroy();
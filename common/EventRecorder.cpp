@@ -130,6 +130,8 @@ EventRecorder::EventRecorder() {
 	_lastEventMillis = 0;
 
 	_recordMode = kPassthrough;
+	_benchmark = false;
+	_playbackFinished = false;
 }
 
 EventRecorder::~EventRecorder() {
@@ -149,6 +151,10 @@ void EventRecorder::init() {
 		if (recordModeString.compareToIgnoreCase("playback") == 0) {
 			_recordMode = kRecorderPlayback;
 			debug(3, "EventRecorder: playback");
+		} else if (recordModeString.compareToIgnoreCase("benchmark") == 0) {
+			_recordMode = kRecorderPlayback;
+			_benchmark = true;
+			debug(3, "EventRecorder: benchmark");
 		} else {
 			_recordMode = kPassthrough;
 			debug(3, "EventRecorder: passthrough");
@@ -322,7 +328,16 @@ void EventRecorder::processMillis(uint32 &millis) {
 	}
 
 	if (_recordMode == kRecorderPlayback) {
-		if (_recordTimeCount > _playbackTimeCount) {
+		if (_benchmark) {
+			// Replay the recorded time on a virtual clock. Once the recording
+			// is exhausted, only delays advance the clock any further.
+			if (_recordTimeCount > _playbackTimeCount) {
+				millis = _lastMillis + readTime(_playbackTimeFile);
+				_playbackTimeCount++;
+			} else {
+				millis = _lastMillis;
+			}
+		} else if (_recordTimeCount > _playbackTimeCount) {
 			d = readTime(_playbackTimeFile);
 
 			while ((_lastMillis + d > millis) && (_lastMillis + d - millis > 50)) {
@@ -342,6 +357,14 @@ void EventRecorder::processMillis(uint32 &millis) {
 }
 
 bool EventRecorder::processDelayMillis(uint &msecs) {
+	if (_recordMode == kRecorderPlayback && _benchmark) {
+		// Never wait in benchmark mode
+		StackLock lock(_timeMutex);
+		if (_recordTimeCount <= _playbackTimeCount)
+			_lastMillis += msecs;
+		return true;
+	}
+
 	if (_recordMode == kRecorderPlayback) {
 		_recordMode = kPassthrough;
 
@@ -397,6 +420,11 @@ bool EventRecorder::pollEvent(Event &ev) {
 			readRecord(_playbackFile, const_cast<uint32&>(_playbackDiff), _playbackEvent, millis);
 			_playbackCount++;
 			_hasPlaybackEvent = true;
+		} else if (_benchmark && !_playbackFinished) {
+			// End the benchmark once all recorded events have been replayed
+			_playbackFinished = true;
+			ev.type = EVENT_QUIT;
+			return true;
 		}
 	}
 
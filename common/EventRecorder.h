@@ -59,6 +59,16 @@ public:
 	/** TODO: Add documentation, this is only used by the backend */
 	bool processDelayMillis(uint &msecs);
 
+	/**
+	 * Returns whether a recording is being replayed in benchmark mode.
+	 *
+	 * In benchmark mode the recorded timing is replayed on a virtual clock,
+	 * without ever waiting for the real time to catch up, and a quit event
+	 * is sent once the recording is exhausted. Backends may use this to
+	 * collect timing statistics.
+	 */
+	bool isBenchmarking() const { return _recordMode == kRecorderPlayback && _benchmark; }
+
 private:
 	bool notifyEvent(const Event &ev);
 	bool notifyPoll();
@@ -88,6 +98,8 @@ private:
 	volatile bool _hasPlaybackEvent;
 	volatile uint32 _playbackTimeCount;
 	Event _playbackEvent;
+	bool _benchmark;
+	bool _playbackFinished;
 	SeekableReadStream *_playbackFile;
 	SeekableReadStream *_playbackTimeFile;
 
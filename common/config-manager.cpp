@@ -24,6 +24,8 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -48,7 +50,7 @@ char const *const ConfigManager::kKeymapperDomain = "keymapper";
 #pragma mark -
 
 
-ConfigManager::ConfigManager() : _activeDomain(0) {
+ConfigManager::ConfigManager() : _activeDomain(0), _hasFlushedDigest(false) {
 }
 
 void ConfigManager::defragment() {
@@ -71,6 +73,8 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	memcpy(_flushedDigest, source._flushedDigest, sizeof(_flushedDigest));
+	_hasFlushedDigest = source._hasFlushedDigest;
 }
 
 
@@ -81,8 +85,10 @@ void ConfigManager::loadDefaultConfigFile() {
 	_filename.clear();  // clear the filename to indicate that we are using the default config file
 
 	// ... load it, if available ...
+	_hasFlushedDigest = false;
 	if (stream) {
 		loadFromStream(*stream);
+		updateFlushedDigest();
 
 		// ... and close it again.
 		delete stream;
@@ -97,6 +103,7 @@ void ConfigManager::loadDefaultConfigFile() {
 
 void ConfigManager::loadConfigFile(const String &filename) {
 	_filename = filename;
+	_hasFlushedDigest = false;
 
 	FSNode node(filename);
 	File cfg_file;
@@ -105,6 +112,7 @@ void ConfigManager::loadConfigFile(const String &filename) {
 	} else {
 		debug("Using configuration file: %s", _filename.c_str());
 		loadFromStream(cfg_file);
+		updateFlushedDigest();
 	}
 }
 
@@ -244,6 +252,19 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	// Build the whole config file in memory first. Most calls to
+	// flushToDisk() happen without any setting having changed since the
+	// last one, in which case we do not touch the file at all.
+	MemoryWriteStreamDynamic data(DisposeAfterUse::YES);
+	writeConfig(data);
+
+	uint8 digest[16];
+	MemoryReadStream dataStream(data.getData(), data.size());
+	computeStreamMD5(dataStream, digest);
+
+	if (_hasFlushedDigest && !memcmp(digest, _flushedDigest, sizeof(digest)))
+		return;
+
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -265,19 +286,46 @@ void ConfigManager::flushToDisk() {
 		stream = dump;
 	}
 
+	// Write everything in one go, keeping the window in which an
+	// interrupted write leaves a truncated file as small as possible.
+	stream->write(data.getData(), data.size());
+	stream->finalize();
+
+	if (stream->err()) {
+		warning("Unable to write configuration file: %s", _filename.empty() ? "default" : _filename.c_str());
+		_hasFlushedDigest = false;
+	} else {
+		memcpy(_flushedDigest, digest, sizeof(digest));
+		_hasFlushedDigest = true;
+	}
+
+	delete stream;
+
+#endif // !__DC__
+}
+
+void ConfigManager::updateFlushedDigest() {
+	MemoryWriteStreamDynamic data(DisposeAfterUse::YES);
+	writeConfig(data);
+
+	MemoryReadStream dataStream(data.getData(), data.size());
+	_hasFlushedDigest = computeStreamMD5(dataStream, _flushedDigest);
+}
+
+void ConfigManager::writeConfig(WriteStream &stream) {
 	// Write the application domain
-	writeDomain(*stream, kApplicationDomain, _appDomain);
+	writeDomain(stream, kApplicationDomain, _appDomain);
 
 #ifdef ENABLE_KEYMAPPER
 	// Write the keymapper domain
-	writeDomain(*stream, kKeymapperDomain, _keymapperDomain);
+	writeDomain(stream, kKeymapperDomain, _keymapperDomain);
 #endif
 
 	DomainMap::const_iterator d;
 
 	// Write the miscellaneous domains next
 	for (d = _miscDomains.begin(); d != _miscDomains.end(); ++d) {
-		writeDomain(*stream, d->_key, d->_value);
+		writeDomain(stream, d->_key, d->_value);
 	}
 
 	// First write the domains in _domainSaveOrder, in that order.
@@ -286,19 +334,15 @@ void ConfigManager::flushToDisk() {
 	Array<String>::const_iterator i;
 	for (i = _domainSaveOrder.begin(); i != _domainSaveOrder.end(); ++i) {
 		if (_gameDomains.contains(*i)) {
-			writeDomain(*stream, *i, _gameDomains[*i]);
+			writeDomain(stream, *i, _gameDomains[*i]);
 		}
 	}
 
 	// Now write the domains which haven't been written yet
 	for (d = _gameDomains.begin(); d != _gameDomains.end(); ++d) {
 		if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), d->_key) == _domainSaveOrder.end())
-			writeDomain(*stream, d->_key, d->_value);
+			writeDomain(stream, d->_key, d->_value);
 	}
-
-	delete stream;
-
-#endif // !__DC__
 }
 
 void ConfigManager::writeDomain(WriteStream &stream, const String &name, const Domain &domain) {
@@ -154,7 +154,9 @@ private:
 
 	void			loadFromStream(SeekableReadStream &stream);
 	void			addDomain(const String &domainName, const Domain &domain);
+	void			writeConfig(WriteStream &stream);
 	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
+	void			updateFlushedDigest();
 	void			renameDomain(const String &oldName, const String &newName, DomainMap &map);
 
 	Domain			_transientDomain;
@@ -173,6 +175,13 @@ private:
 	Domain *		_activeDomain;
 
 	String			_filename;
+
+	/**
+	 * MD5 of the config file contents as last written (or read), used by
+	 * flushToDisk() to skip rewriting an unchanged config file.
+	 */
+	uint8			_flushedDigest[16];
+	bool			_hasFlushedDigest;
 };
 
 }	// End of namespace Common
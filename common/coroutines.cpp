@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "common/memorypool.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -71,6 +72,44 @@ static void displayCoroStats() {
 } // End of anonymous namespace
 #endif
 
+namespace {
+enum {
+	kContextPoolGranularity = 16,
+	kContextPoolCount = 16
+};
+
+/** Pools for the coroutine contexts, by size in steps of kContextPoolGranularity */
+static MemoryPool *s_contextPools[kContextPoolCount];
+} // End of anonymous namespace
+
+void *CoroBaseContext::operator new(size_t size) {
+	const size_t pool = (size - 1) / kContextPoolGranularity;
+
+	// Large contexts are rare, don't bother pooling them
+	if (pool >= kContextPoolCount)
+		return ::operator new(size);
+
+	if (!s_contextPools[pool])
+		s_contextPools[pool] = new MemoryPool((pool + 1) * kContextPoolGranularity);
+
+	return s_contextPools[pool]->allocChunk();
+}
+
+void CoroBaseContext::operator delete(void *ptr, size_t size) {
+	if (!ptr)
+		return;
+
+	const size_t pool = (size - 1) / kContextPoolGranularity;
+
+	if (pool >= kContextPoolCount) {
+		::operator delete(ptr);
+		return;
+	}
+
+	assert(s_contextPools[pool]);
+	s_contextPools[pool]->freeChunk(ptr);
+}
+
 CoroBaseContext::CoroBaseContext(const char *func)
 	: _line(0), _sleep(0), _subctx(0) {
 #ifdef COROUTINE_DEBUG
@@ -133,6 +172,13 @@ CoroutineScheduler::~CoroutineScheduler() {
 	Common::List<EVENT *>::iterator i;
 	for (i = _events.begin(); i != _events.end(); ++i)
 		delete *i;
+
+	// All contexts belong to the processes killed above, so the pools
+	// can go as well
+	for (int j = 0; j < kContextPoolCount; ++j) {
+		delete s_contextPools[j];
+		s_contextPools[j] = 0;
+	}
 }
 
 void CoroutineScheduler::reset() {
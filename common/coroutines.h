@@ -65,6 +65,13 @@ struct CoroBaseContext {
 	 * Destructor for coroutine context
 	 */
 	virtual ~CoroBaseContext();
+
+	/**
+	 * A context is allocated for nearly every call of a coroutine, so
+	 * contexts are taken from memory pools instead of the heap.
+	 */
+	void *operator new(size_t size);
+	void operator delete(void *ptr, size_t size);
 };
 
 typedef CoroBaseContext *CoroContext;
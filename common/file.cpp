@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 
 namespace Common {
@@ -44,6 +45,8 @@ bool File::open(const String &filename, Archive &archive) {
 	assert(!filename.empty());
 	assert(!_handle);
 
+	PROFILE_ZONE("File::open");
+
 	SeekableReadStream *stream = 0;
 
 	if ((stream = archive.createReadStreamForMember(filename))) {
@@ -135,7 +135,8 @@ private:
 
 		byte *old_data = _data;
 
-		_capacity = new_len + 32;
+		// Grow geometrically, so that many small writes stay cheap
+		_capacity = (new_len + 32 > _capacity * 2) ? new_len + 32 : _capacity * 2;
 		_data = (byte *)malloc(_capacity);
 		_ptr = _data + _pos;
 
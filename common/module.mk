@@ -24,6 +24,7 @@ MODULE_OBJS := \
 	md5.o \
 	mutex.o \
 	platform.o \
+	profiler.o \
 	quicktime.o \
 	random.o \
 	rational.o \
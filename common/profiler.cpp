@@ -0,0 +1,218 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/profiler.h"
+
+#ifdef USE_FRAME_PROFILER
+
+#include "common/config-manager.h"
+#include "common/mutex.h"
+#include "common/savefile.h"
+#include "common/textconsole.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(FrameProfiler);
+
+FrameProfiler *FrameProfiler::_active = 0;
+
+FrameProfiler::FrameProfiler() : _enabled(false), _osd(false), _mutex(0), _startTime(0), _frameStart(0),
+	_traceFull(false), _osdFrames(0), _osdStart(0) {
+}
+
+FrameProfiler::~FrameProfiler() {
+	deinit();
+	if (_mutex)
+		g_system->deleteMutex(_mutex);
+}
+
+void FrameProfiler::init() {
+	// Not every backend can create mutexes before initBackend(), so this is
+	// done here rather than in the constructor
+	if (!_mutex)
+		_mutex = g_system->createMutex();
+
+	_traceFileName = ConfMan.get("profiler_trace_file");
+	_osd = ConfMan.getBool("profiler_osd");
+
+	_startTime = _frameStart = _osdStart = getTime();
+	_traceEvents.clear();
+	_traceFull = false;
+	_zoneTotals.clear();
+	_osdFrames = 0;
+
+	_enabled = _osd || !_traceFileName.empty();
+	if (_enabled)
+		_active = this;
+}
+
+void FrameProfiler::deinit() {
+	if (!_enabled)
+		return;
+
+	// Zones which already got the profiler check _enabled under the lock
+	_active = 0;
+
+	StackLock lock(_mutex);
+	_enabled = false;
+
+	if (!_traceFileName.empty()) {
+		OutSaveFile *file = g_system->getSavefileManager()->openForSaving(_traceFileName, false);
+		if (file) {
+			writeTrace(*file);
+			file->finalize();
+			if (file->err())
+				warning("FrameProfiler: Writing '%s' failed", _traceFileName.c_str());
+			delete file;
+		} else {
+			warning("FrameProfiler: Cannot open '%s'", _traceFileName.c_str());
+		}
+	}
+
+	_traceEvents.clear();
+	_zoneTotals.clear();
+}
+
+void FrameProfiler::addZone(const char *name, ProfileTrack track, uint32 start, uint32 end) {
+	StackLock lock(_mutex);
+	if (!_enabled)
+		return;
+
+	const uint32 duration = end - start;
+	addTraceEvent(name, track, start, duration);
+
+	if (_osd) {
+		// Zone names are literals, so comparing the pointers is enough
+		for (uint i = 0; i < _zoneTotals.size(); ++i) {
+			if (_zoneTotals[i].name == name) {
+				_zoneTotals[i].time += duration;
+				return;
+			}
+		}
+
+		ZoneTotal total;
+		total.name = name;
+		total.time = duration;
+		_zoneTotals.push_back(total);
+	}
+}
+
+void FrameProfiler::setCounter(const char *name, int32 value) {
+	StackLock lock(_mutex);
+	if (!_enabled)
+		return;
+
+	addTraceEvent(name, -1, getTime(), (uint32)value);
+}
+
+void FrameProfiler::endFrame() {
+	const uint32 now = getTime();
+	bool showOSD = false;
+
+	{
+		// Our mutexes are recursive, so addZone() may lock it again
+		StackLock lock(_mutex);
+		if (!_enabled)
+			return;
+
+		addZone("frame", kProfileTrackMain, _frameStart, now);
+		_frameStart = now;
+
+		if (_osd) {
+			++_osdFrames;
+			showOSD = (now - _osdStart >= kOSDInterval);
+		}
+	}
+
+	// The OSD message is shown without holding the lock
+	if (showOSD)
+		updateOSD(now);
+}
+
+void FrameProfiler::addTraceEvent(const char *name, int8 track, uint32 start, uint32 duration) {
+	if (_traceFileName.empty() || _traceFull)
+		return;
+
+	if (_traceEvents.size() >= kMaxTraceEvents) {
+		warning("FrameProfiler: Trace buffer full, no further events are recorded");
+		_traceFull = true;
+		return;
+	}
+
+	TraceEvent event;
+	event.name = name;
+	event.start = start - _startTime;
+	event.duration = duration;
+	event.track = track;
+	_traceEvents.push_back(event);
+}
+
+void FrameProfiler::updateOSD(uint32 now) {
+	String message;
+
+	{
+		StackLock lock(_mutex);
+
+		// Average time per frame in tenths of a millisecond
+		for (uint i = 0; i < _zoneTotals.size(); ++i) {
+			const uint32 time = _zoneTotals[i].time / _osdFrames / 100;
+			if (!message.empty())
+				message += '\n';
+			message += String::format("%s: %d.%d ms", _zoneTotals[i].name, time / 10, time % 10);
+		}
+
+		_zoneTotals.clear();
+		_osdFrames = 0;
+		_osdStart = now;
+	}
+
+	g_system->displayMessageOnOSD(message.c_str());
+}
+
+void FrameProfiler::writeTrace(WriteStream &stream) const {
+	static const char *const trackNames[] = { "main", "audio", "timer" };
+
+	stream.writeString("{\"traceEvents\":[\n");
+
+	for (uint i = 0; i < ARRAYSIZE(trackNames); ++i) {
+		stream.writeString(String::format("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+			i ? ",\n" : "", i, trackNames[i]));
+	}
+
+	for (uint i = 0; i < _traceEvents.size(); ++i) {
+		const TraceEvent &event = _traceEvents[i];
+
+		if (event.track < 0) {
+			stream.writeString(String::format(",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":0,\"ts\":%u,\"args\":{\"value\":%d}}",
+				event.name, event.start, (int32)event.duration));
+		} else {
+			stream.writeString(String::format(",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%u,\"dur\":%u}",
+				event.name, event.track, event.start, event.duration));
+		}
+	}
+
+	stream.writeString("\n]}\n");
+}
+
+} // End of namespace Common
+
+#endif // USE_FRAME_PROFILER
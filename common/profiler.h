@@ -0,0 +1,192 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+
+/**
+ * @file
+ * Frame profiler instrumentation.
+ *
+ * Code is instrumented with the following macros, which expand to nothing
+ * unless ScummVM was configured with --enable-frame-profiler:
+ *
+ * - PROFILE_ZONE(name) measures the time until the end of the enclosing
+ *   scope.
+ * - PROFILE_ZONE_TRACK(name, track) does the same for code which does not
+ *   run on the main thread, like the mixer or the timer callbacks.
+ * - PROFILE_COUNTER(name, value) records the current value of a counter.
+ * - PROFILE_FRAME() marks the end of a frame. It is called by the backend
+ *   whenever the screen is updated.
+ *
+ * Names have to be string literals.
+ *
+ * The macros do nothing until FrameProfiler::init() has been called from the
+ * main thread, after the backend has been initialized.
+ *
+ * Timestamps come from OSystem::getMicros(). Its precision depends on the
+ * backend: POSIX, null and SDL 2 ports have microsecond timers, but other
+ * ports only provide milliseconds, in which case short zones mostly show up
+ * as 0.
+ */
+
+#ifdef USE_FRAME_PROFILER
+
+#include "common/array.h"
+#include "common/singleton.h"
+#include "common/str.h"
+#include "common/system.h"
+
+namespace Common {
+
+class WriteStream;
+
+enum ProfileTrack {
+	kProfileTrackMain = 0,
+	kProfileTrackAudio = 1,
+	kProfileTrackTimer = 2
+};
+
+/**
+ * Collects the profiling zones and counters, writes them as a Chrome
+ * trace-event JSON file and shows the average time spent in each zone
+ * per frame on the OSD.
+ *
+ * The profiler is configured with the "profiler_trace_file" and
+ * "profiler_osd" config keys, and does nothing if neither is set.
+ */
+class FrameProfiler : public Singleton<FrameProfiler> {
+	friend class Singleton<SingletonBaseType>;
+	FrameProfiler();
+	~FrameProfiler();
+public:
+	void init();
+	void deinit();
+
+	/**
+	 * Returns the profiler while it is recording, or 0 otherwise. The
+	 * instrumentation macros only go through this, so the singleton is
+	 * never created by the mixer or timer threads.
+	 */
+	static FrameProfiler *getActive() { return _active; }
+
+	/** Returns the current time in microseconds. */
+	uint32 getTime() const { return g_system->getMicros(); }
+
+	void addZone(const char *name, ProfileTrack track, uint32 start, uint32 end);
+	void setCounter(const char *name, int32 value);
+	void endFrame();
+
+private:
+	enum {
+		kMaxTraceEvents = 1 << 20,
+		kOSDInterval = 1000000
+	};
+
+	struct TraceEvent {
+		const char *name;
+		uint32 start;
+		uint32 duration;	///< Counter value for counter events
+		int8 track;		///< -1 for counter events
+	};
+
+	struct ZoneTotal {
+		const char *name;
+		uint32 time;
+	};
+
+	void addTraceEvent(const char *name, int8 track, uint32 start, uint32 duration);
+	void updateOSD(uint32 now);
+	void writeTrace(WriteStream &stream) const;
+
+	static FrameProfiler *_active;
+
+	bool _enabled;
+	bool _osd;
+	String _traceFileName;
+	OSystem::MutexRef _mutex;
+
+	uint32 _startTime;
+	uint32 _frameStart;
+
+	Array<TraceEvent> _traceEvents;
+	bool _traceFull;
+
+	Array<ZoneTotal> _zoneTotals;
+	uint32 _osdFrames;
+	uint32 _osdStart;
+};
+
+/**
+ * Adds a zone to the profiler covering the lifetime of the object.
+ */
+class ProfileZone {
+public:
+	ProfileZone(const char *name, ProfileTrack track) : _name(name), _track(track) {
+		_profiler = FrameProfiler::getActive();
+		_start = _profiler ? _profiler->getTime() : 0;
+	}
+
+	~ProfileZone() {
+		if (_profiler)
+			_profiler->addZone(_name, _track, _start, _profiler->getTime());
+	}
+
+private:
+	FrameProfiler *_profiler;
+	const char *_name;
+	ProfileTrack _track;
+	uint32 _start;
+};
+
+} // End of namespace Common
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+#define PROFILE_ZONE(name) \
+	Common::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name, Common::kProfileTrackMain)
+#define PROFILE_ZONE_TRACK(name, track) \
+	Common::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name, track)
+#define PROFILE_COUNTER(name, value) \
+	do { \
+		if (Common::FrameProfiler *profiler_ = Common::FrameProfiler::getActive()) \
+			profiler_->setCounter(name, value); \
+	} while (0)
+#define PROFILE_FRAME() \
+	do { \
+		if (Common::FrameProfiler *profiler_ = Common::FrameProfiler::getActive()) \
+			profiler_->endFrame(); \
+	} while (0)
+
+#else
+
+#define PROFILE_ZONE(name) do {} while (0)
+#define PROFILE_ZONE_TRACK(name, track) do {} while (0)
+#define PROFILE_COUNTER(name, value) do {} while (0)
+#define PROFILE_FRAME() do {} while (0)
+
+#endif // USE_FRAME_PROFILER
+
+#endif
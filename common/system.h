@@ -896,6 +896,14 @@ public:
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
+	/**
+	 * Get a timestamp in microseconds, used for profiling. Unlike
+	 * getMillis(), this must not be affected by the event recorder, so
+	 * backends supporting event recording should override it. The
+	 * default implementation only has millisecond precision.
+	 */
+	virtual uint32 getMicros() { return getMillis() * 1000; }
+
 	/**
 	 * Get the current time and date, in the local timezone.
 	 * Corresponds on many systems to the combination of time()
@@ -28,6 +28,12 @@
 
 namespace Common {
 
+enum {
+	kRecordDocument = 1,
+	kRecordOpenKey = 2,
+	kRecordCloseKey = 3
+};
+
 XMLParser::~XMLParser() {
 	while (!_activeKey.empty())
 		freeNode(_activeKey.pop());
@@ -80,6 +86,13 @@ void XMLParser::close() {
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
+	// Errors raised while replaying recorded data have no text to point at.
+	if (!_stream) {
+		Common::String errorMessage = "\nParser error: " + errStr + "\n\n";
+		g_system->logMessage(LogMessageType::kError, errorMessage.c_str());
+		return false;
+	}
+
 	const int startPosition = _stream->pos();
 	int currentPosition = startPosition;
 	int lineCount = 1;
@@ -152,7 +165,6 @@ bool XMLParser::parseXMLHeader(ParserNode *node) {
 }
 
 bool XMLParser::parseActiveKey(bool closed) {
-	bool ignore = false;
 	assert(_activeKey.empty() == false);
 
 	ParserNode *key = _activeKey.top();
@@ -184,6 +196,29 @@ bool XMLParser::parseActiveKey(bool closed) {
 		return parserError("Unexpected key in the active scope ('" + key->name + "').");
 	}
 
+	if (_recordStream) {
+		_recordStream->writeByte(kRecordOpenKey);
+		recordString(key->name);
+		_recordStream->writeUint16LE(key->values.size());
+
+		for (StringMap::const_iterator i = key->values.begin(); i != key->values.end(); ++i) {
+			recordString(i->_key);
+			recordString(i->_value);
+		}
+	}
+
+	if (!processKey(key))
+		return false;
+
+	if (closed)
+		return closeKey();
+
+	return true;
+}
+
+bool XMLParser::processKey(ParserNode *key) {
+	bool ignore = false;
+
 	// check if any of the parents must be ignored.
 	// if a parent is ignored, all children are too.
 	for (int i = _activeKey.size() - 1; i >= 0; --i) {
@@ -201,9 +236,6 @@ bool XMLParser::parseActiveKey(bool closed) {
 		return false;
 	}
 
-	if (closed)
-		return closeKey();
-
 	return true;
 }
 
@@ -291,6 +323,9 @@ bool XMLParser::closeKey() {
 	if (ignore == false)
 		result = closedKeyCallback(_activeKey.top());
 
+	if (_recordStream && !_activeKey.top()->header)
+		_recordStream->writeByte(kRecordCloseKey);
+
 	freeNode(_activeKey.pop());
 
 	return result;
@@ -311,6 +346,9 @@ bool XMLParser::parse() {
 
 	cleanup();
 
+	if (_recordStream)
+		_recordStream->writeByte(kRecordDocument);
+
 	bool activeClosure = false;
 	bool activeHeader = false;
 	bool selfClosure;
@@ -460,6 +498,88 @@ bool XMLParser::parse() {
 	return true;
 }
 
+void XMLParser::recordString(const String &str) {
+	_recordStream->writeUint16LE(str.size());
+	_recordStream->write(str.c_str(), str.size());
+}
+
+bool XMLParser::replayString(SeekableReadStream &stream, String &str) {
+	uint16 size = stream.readUint16LE();
+	str.clear();
+
+	while (size--) {
+		const char c = stream.readByte();
+		if (c == 0)
+			return false;
+		str += c;
+	}
+
+	return !stream.err() && !stream.eos();
+}
+
+bool XMLParser::replay(SeekableReadStream &stream) {
+	if (_XMLkeys == 0)
+		buildLayout();
+
+	while (!_activeKey.empty())
+		freeNode(_activeKey.pop());
+
+	_state = kParserNeedKey;
+
+	while (stream.pos() < stream.size()) {
+		const byte op = stream.readByte();
+
+		if (op == kRecordDocument) {
+			if (!_activeKey.empty())
+				return parserError("Unexpected start of recorded document.");
+
+			cleanup();
+		} else if (op == kRecordOpenKey) {
+			ParserNode *node = allocNode();
+			node->ignore = false;
+			node->header = false;
+			node->depth = _activeKey.size();
+			node->layout = 0;
+			_activeKey.push(node);
+
+			if (!replayString(stream, node->name))
+				return parserError("Invalid recorded key name.");
+
+			uint16 count = stream.readUint16LE();
+			while (count--) {
+				String name, value;
+				if (!replayString(stream, name) || !replayString(stream, value))
+					return parserError("Invalid recorded value inside key '" + node->name + "'.");
+
+				node->values[name] = value;
+			}
+
+			XMLKeyLayout *layout = (_activeKey.size() == 1) ? _XMLkeys : getParentNode(node)->layout;
+			if (!layout->children.contains(node->name))
+				return parserError("Unexpected key in the active scope ('" + node->name + "').");
+
+			node->layout = layout->children[node->name];
+
+			if (!processKey(node))
+				return false;
+		} else if (op == kRecordCloseKey) {
+			if (_activeKey.empty())
+				return parserError("Unexpected recorded closure.");
+
+			const String name = _activeKey.top()->name;
+			if (!closeKey())
+				return parserError("Missing data when closing key '" + name + "'.");
+		} else {
+			return parserError("Invalid recorded data.");
+		}
+	}
+
+	if (stream.err() || !_activeKey.empty())
+		return parserError("Unexpected end of recorded data.");
+
+	return true;
+}
+
 bool XMLParser::skipSpaces() {
 	if (!isSpace(_char))
 		return false;
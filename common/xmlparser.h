@@ -37,6 +37,7 @@
 namespace Common {
 
 class SeekableReadStream;
+class WriteStream;
 
 #define MAX_XML_DEPTH 8
 
@@ -92,7 +93,7 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(0), _stream(0) {}
+	XMLParser() : _XMLkeys(0), _stream(0), _recordStream(0) {}
 
 	virtual ~XMLParser();
 
@@ -187,6 +188,24 @@ public:
 	 */
 	bool parse();
 
+	/**
+	 * Sets a stream into which every key accepted by parse() gets
+	 * recorded in a compact binary form. The recorded data can later be
+	 * fed to replay() to run the very same key callbacks without having
+	 * to tokenize the XML text again.
+	 * Pass 0 to stop recording. The parser does not take ownership of
+	 * the stream.
+	 */
+	void setRecordStream(WriteStream *stream) { _recordStream = stream; }
+
+	/**
+	 * Runs the key callbacks for all documents previously recorded via
+	 * setRecordStream(), reading from the current position of the given
+	 * stream until the end of the recorded data.
+	 * Returns false if the data is malformed or a callback failed.
+	 */
+	bool replay(SeekableReadStream &stream);
+
 	/**
 	 * Returns the active node being parsed (the one on top of
 	 * the node stack).
@@ -327,6 +346,15 @@ protected:
 
 	bool parseXMLHeader(ParserNode *node);
 
+	/**
+	 * Runs the key callback for the given node, unless it or any of its
+	 * parents are to be ignored.
+	 */
+	bool processKey(ParserNode *key);
+
+	void recordString(const String &str);
+	bool replayString(SeekableReadStream &stream, String &str);
+
 	/**
 	 * Overload if your parser needs to support parsing the same file
 	 * several times, so you can clean up the internal state of the
@@ -339,6 +367,7 @@ protected:
 private:
 	char _char;
 	SeekableReadStream *_stream;
+	WriteStream *_recordStream;
 	String _fileName;
 
 	ParserState _state; /** Internal state of the parser */
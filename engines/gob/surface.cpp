@@ -41,6 +41,55 @@ static void plotPixel(int x, int y, int color, void *data) {
 	dest->putPixel(x, y, color);
 }
 
+template<typename T>
+static void blitTransparent(byte *dst, const byte *src, uint16 width, uint16 height,
+		uint32 dstPitch, uint32 srcPitch, T transp) {
+
+	while (height-- > 0) {
+		      T *dstRow = (      T *)dst;
+		const T *srcRow = (const T *)src;
+
+		for (uint16 i = 0; i < width; i++, dstRow++, srcRow++)
+			if (*srcRow != transp)
+				*dstRow = *srcRow;
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+template<typename T>
+static void blitScaledRows(byte *dst, const byte *src, uint16 width, uint16 height,
+		uint32 dstPitch, uint32 srcPitch, frac_t step, int32 transp) {
+
+	frac_t posW = 0, posH = 0;
+	while (height-- > 0) {
+		      T *dstRow = (      T *)dst;
+		const T *srcRow = (const T *)src;
+
+		posW = 0;
+
+		for (uint16 i = 0; i < width; i++, dstRow++) {
+			if ((transp == -1) || (*srcRow != (T) transp))
+				*dstRow = *srcRow;
+
+			posW += step;
+			while (posW >= ((frac_t) FRAC_ONE)) {
+				srcRow++;
+				posW -= FRAC_ONE;
+			}
+		}
+
+		posH += step;
+		while (posH >= ((frac_t) FRAC_ONE)) {
+			src  += srcPitch;
+			posH -= FRAC_ONE;
+		}
+
+		dst += dstPitch;
+	}
+}
+
 
 Pixel::Pixel(byte *vidMem, uint8 bpp, byte *min, byte *max) :
 	_vidMem(vidMem), _bpp(bpp), _min(min), _max(max) {
@@ -333,6 +382,10 @@ void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int1
 		// Nothing to do
 		return;
 
+	// A transparent color which doesn't fit into a pixel never matches
+	if ((transp != -1) && (((uint32) transp) >> (8 * _bpp)))
+		transp = -1;
+
 	if ((left == 0) && (_width == from._width) && (_width == width) && (transp == -1)) {
 		// If these conditions are met, we can directly use memmove
 
@@ -364,20 +417,13 @@ void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int1
 	// Otherwise, we have to copy by pixel
 
 	// Pointers to the blit destination and source start points
-	     Pixel dst =      get(x   , y);
-	ConstPixel src = from.get(left, top);
-
-	while (height-- > 0) {
-		     Pixel dstRow = dst;
-		ConstPixel srcRow = src;
-
-		for (uint16 i = 0; i < width; i++, dstRow++, srcRow++)
-			if (srcRow.get() != ((uint32) transp))
-				dstRow.set(srcRow.get());
+	      byte *dst =      getData(x   , y);
+	const byte *src = from.getData(left, top);
 
-		dst +=      _width;
-		src += from._width;
-	}
+	if (_bpp == 1)
+		blitTransparent<uint8 >(dst, src, width, height, _width * _bpp, from._width * from._bpp, transp);
+	else
+		blitTransparent<uint16>(dst, src, width, height, _width * _bpp, from._width * from._bpp, transp);
 }
 
 void Surface::blit(const Surface &from, int16 x, int16 y, int32 transp) {
@@ -427,32 +473,14 @@ void Surface::blitScaled(const Surface &from, int16 left, int16 top, int16 right
 
 	frac_t step = scale.getInverse().toFrac();
 
-	frac_t posW = 0, posH = 0;
-	while (height-- > 0) {
-		      byte *dstRow = dst;
-		const byte *srcRow = src;
-
-		posW = 0;
-
-		for (uint16 i = 0; i < width; i++, dstRow += _bpp) {
-			memmove(dstRow, srcRow, _bpp);
-
-			posW += step;
-			while (posW >= ((frac_t) FRAC_ONE)) {
-				srcRow += from._bpp;
-				posW   -= FRAC_ONE;
-			}
-		}
-
-		posH += step;
-		while (posH >= ((frac_t) FRAC_ONE)) {
-			src  += from._width * from._bpp;
-			posH -= FRAC_ONE;
-		}
-
-		dst += _width * _bpp;
-	}
+	// A transparent color which doesn't fit into a pixel never matches
+	if ((transp != -1) && (((uint32) transp) >> (8 * _bpp)))
+		transp = -1;
 
+	if (_bpp == 1)
+		blitScaledRows<uint8 >(dst, src, width, height, _width * _bpp, from._width * from._bpp, step, transp);
+	else
+		blitScaledRows<uint16>(dst, src, width, height, _width * _bpp, from._width * from._bpp, step, transp);
 }
 
 void Surface::blitScaled(const Surface &from, int16 x, int16 y, Common::Rational scale, int32 transp) {
@@ -1030,6 +1030,12 @@ void Screen::shuffleScreen(int sx, int sy, int w, int h, int srcPage, int dstPag
 	int wait;
 	for (y = 0; y < h && !_vm->shouldQuit(); ++y) {
 		start = (int32)_system->getMillis();
+
+		// Mark the whole area at once, so the pixels set below don't
+		// each add a dirty rect of their own
+		if (dstPage == 0 || dstPage == 1)
+			addDirtyRect(sx, sy, w, h);
+
 		int y_cur = y;
 		for (x = 0; x < w; ++x) {
 			int i = sx + x_offs[x];
@@ -1042,8 +1048,6 @@ void Screen::shuffleScreen(int sx, int sy, int w, int h, int srcPage, int dstPag
 			if (!transparent || color != 0)
 				setPagePixel(dstPage, i, j, color);
 		}
-		// forcing full update for now
-		_forceFullUpdate = true;
 		updateScreen();
 		now = (int32)_system->getMillis();
 		wait = ticks * _vm->tickLength() - (now - start);
@@ -1521,6 +1525,15 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		return;
 	}
 
+	// Plain copies without scaling are by far the most common case, so
+	// skip calling the plot function for every pixel there
+	if (ppc == 0) {
+		if (_dsProcessLine == &Screen::drawShapeProcessLineNoScaleUpwind)
+			_dsProcessLine = &Screen::drawShapeProcessLineNoScaleUpwindCopy;
+		else if (_dsProcessLine == &Screen::drawShapeProcessLineNoScaleDownwind)
+			_dsProcessLine = &Screen::drawShapeProcessLineNoScaleDownwindCopy;
+	}
+
 	int curY = y;
 	const uint8 *src = shapeData;
 	uint8 *dst = _dsDstPage = getPagePtr(pageNum);
@@ -1858,6 +1871,34 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
+void Screen::drawShapeProcessLineNoScaleUpwindCopy(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
+	do {
+		uint8 c = *src++;
+		if (c) {
+			*dst++ = c;
+			cnt--;
+		} else {
+			c = *src++;
+			dst += c;
+			cnt -= c;
+		}
+	} while (cnt > 0);
+}
+
+void Screen::drawShapeProcessLineNoScaleDownwindCopy(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
+	do {
+		uint8 c = *src++;
+		if (c) {
+			*dst-- = c;
+			cnt--;
+		} else {
+			c = *src++;
+			dst -= c;
+			cnt -= c;
+		}
+	} while (cnt > 0);
+}
+
 void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -3212,10 +3253,26 @@ void Screen::addDirtyRect(int x, int y, int w, int h) {
 
 		// Conversely, if we find rectangles which are contained in
 		// the new one, we can remove them
-		if (r.contains(*it))
+		if (r.contains(*it)) {
 			it = _dirtyRects.erase(it);
-		else
-			++it;
+			continue;
+		}
+
+		// Merge rectangles which overlap or touch, as long as their
+		// union isn't larger than both of them together. Since the
+		// new rectangle grew, the search has to start over.
+		if (r.left <= it->right && it->left <= r.right && r.top <= it->bottom && it->top <= r.bottom) {
+			Common::Rect merged(r);
+			merged.extend(*it);
+			if (merged.width() * merged.height() <= r.width() * r.height() + it->width() * it->height()) {
+				r = merged;
+				_dirtyRects.erase(it);
+				it = _dirtyRects.begin();
+				continue;
+			}
+		}
+
+		++it;
 	}
 
 	// If we got here, we can safely add r to the list of dirty rects.
@@ -443,19 +443,25 @@ void Screen_v2::checkedPageUpdate(int srcPage, int dstPage) {
 	uint32 *dst = (uint32 *)getPagePtr(dstPage);
 	uint32 *page0 = (uint32 *)getPagePtr(0);
 
-	bool updated = false;
+	int top = 200, bottom = 0;
+	int left = 80, right = 0;
 
 	for (int y = 0; y < 200; ++y) {
 		for (int x = 0; x < 80; ++x, ++src, ++dst, ++page0) {
 			if (*src != *dst) {
-				updated = true;
 				*dst = *page0 = *src;
+
+				// Keep track of the changed area, in 4 pixel columns
+				top = MIN(top, y);
+				bottom = y + 1;
+				left = MIN(left, x);
+				right = MAX(right, x + 1);
 			}
 		}
 	}
 
-	if (updated)
-		addDirtyRect(0, 0, 320, 200);
+	if (bottom > top)
+		addDirtyRect(left << 2, top, (right - left) << 2, bottom - top);
 }
 
 } // End of namespace Kyra
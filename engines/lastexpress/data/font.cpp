@@ -189,7 +189,8 @@ Common::Rect Font::drawString(Graphics::Surface *surface, int16 x, int16 y, Comm
 		currentX += getCharWidth((unsigned char)str[i]);
 	}
 
-	return Common::Rect(x, y, x + currentX, y + (int16)_charHeight);
+	// Characters are drawn as 16x18 blocks, whatever their width
+	return Common::Rect(x, y, currentX + 16, y + 18);
 }
 
 Common::Rect Font::drawString(Graphics::Surface *surface, int16 x, int16 y, const uint16 *str, uint16 length) {
@@ -199,7 +200,8 @@ Common::Rect Font::drawString(Graphics::Surface *surface, int16 x, int16 y, cons
 		currentX += getCharWidth(str[i]);
 	}
 
-	return Common::Rect(x, y, x + currentX, y + (int16)_charHeight);
+	// Characters are drawn as 16x18 blocks, whatever their width
+	return Common::Rect(x, y, currentX + 16, y + 18);
 }
 
 } // End of namespace LastExpress
@@ -78,7 +78,7 @@ void FrameInfo::read(Common::SeekableReadStream *in, bool isSequence) {
 
 AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool ignoreSubtype) : _palette(NULL), _ignoreSubtype(ignoreSubtype) {
 	_palSize = 1;
-	// TODO: use just the needed rectangle
+	// Frames are decoded on a full screen surface and cropped afterwards
 	_image.create(640, 480, Graphics::PixelFormat::createFormatCLUT8());
 
 	//debugC(6, kLastExpressDebugGraphics, "    Offsets: data=%d, unknown=%d, palette=%d", f.dataOffset, f.unknown, f.paletteOffset);
@@ -120,6 +120,8 @@ AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool ig
 	readPalette(in, f);
 	_rect = Common::Rect((int16)f.xPos1, (int16)f.yPos1, (int16)f.xPos2, (int16)f.yPos2);
 	//_rect.debugPrint(0, "Frame rect:");
+
+	crop();
 }
 
 AnimFrame::~AnimFrame() {
@@ -128,13 +130,66 @@ AnimFrame::~AnimFrame() {
 }
 
 Common::Rect AnimFrame::draw(Graphics::Surface *s) {
-	byte *inp = (byte *)_image.pixels;
-	uint16 *outp = (uint16 *)s->pixels;
-	for (int i = 0; i < 640 * 480; i++, inp++, outp++) {
-		if (*inp)
-			*outp = _palette[*inp];
+	if (_drawRect.isEmpty())
+		return _rect;
+
+	for (int16 y = 0; y < _image.h; y++) {
+		const byte *inp = (const byte *)_image.getBasePtr(0, y);
+		uint16 *outp = (uint16 *)s->getBasePtr(_drawRect.left, _drawRect.top + y);
+		for (int16 x = 0; x < _image.w; x++, inp++, outp++) {
+			if (*inp)
+				*outp = _palette[*inp];
+		}
 	}
-	return _rect;
+
+	// Report the area which was actually drawn: the frame rect does
+	// not always match the decoded data
+	return _drawRect;
+}
+
+uint32 AnimFrame::getSize() const {
+	return _image.w * _image.h + _palSize * sizeof(uint16) + sizeof(AnimFrame);
+}
+
+void AnimFrame::crop() {
+	// Find the bounding box of the non-transparent pixels
+	int16 left = 640, top = 480, right = 0, bottom = 0;
+	for (int16 y = 0; y < 480; y++) {
+		const byte *row = (const byte *)_image.getBasePtr(0, y);
+
+		int16 first = 0;
+		while (first < 640 && !row[first])
+			first++;
+
+		if (first == 640)
+			continue;
+
+		int16 last = 639;
+		while (!row[last])
+			last--;
+
+		left = MIN(left, first);
+		right = MAX(right, (int16)(last + 1));
+		if (top == 480)
+			top = y;
+		bottom = y + 1;
+	}
+
+	if (top == 480) {
+		_drawRect = Common::Rect();
+		_image.free();
+		return;
+	}
+
+	_drawRect = Common::Rect(left, top, right, bottom);
+
+	Graphics::Surface cropped;
+	cropped.create(_drawRect.width(), _drawRect.height(), Graphics::PixelFormat::createFormatCLUT8());
+	for (int16 y = 0; y < cropped.h; y++)
+		memcpy(cropped.getBasePtr(0, y), _image.getBasePtr(left, top + y), cropped.w);
+
+	_image.free();
+	_image = cropped;
 }
 
 void AnimFrame::readPalette(Common::SeekableReadStream *in, const FrameInfo &f) {
@@ -338,6 +393,7 @@ Sequence::~Sequence() {
 }
 
 void Sequence::reset() {
+	clearFrameCache();
 	_frames.clear();
 	delete _stream;
 	_stream = NULL;
@@ -415,9 +471,49 @@ AnimFrame *Sequence::getFrame(uint16 index) {
 	if (frame->compressionType == 0)
 		return NULL;
 
+	// Looping sequences request the same frames over and over again
+	FrameCache::iterator i = _frameCache.find(index);
+	if (i != _frameCache.end()) {
+		i->_value.lastUse = ++_frameCacheUse;
+		return i->_value.frame;
+	}
+
 	debugC(9, kLastExpressDebugGraphics, "Decoding sequence %s: frame %d / %d", _name.c_str(), index, _frames.size() - 1);
 
-	return new AnimFrame(_stream, *frame);
+	CachedFrame entry;
+	entry.frame = new AnimFrame(_stream, *frame);
+	entry.lastUse = ++_frameCacheUse;
+
+	const uint32 size = entry.frame->getSize();
+	evictFrames(size);
+
+	_frameCache[index] = entry;
+	_frameCacheSize += size;
+
+	return entry.frame;
+}
+
+void Sequence::evictFrames(uint32 size) {
+	while (!_frameCache.empty() && _frameCacheSize + size > kFrameCacheMaxSize) {
+		FrameCache::iterator oldest = _frameCache.begin();
+		for (FrameCache::iterator i = _frameCache.begin(); i != _frameCache.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+
+		_frameCacheSize -= oldest->_value.frame->getSize();
+		delete oldest->_value.frame;
+		_frameCache.erase(oldest);
+	}
+}
+
+void Sequence::clearFrameCache() {
+	for (FrameCache::iterator i = _frameCache.begin(); i != _frameCache.end(); ++i)
+		delete i->_value.frame;
+
+	_frameCache.clear();
+	_frameCacheSize = 0;
+	_frameCacheUse = 0;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -438,11 +534,7 @@ Common::Rect SequenceFrame::draw(Graphics::Surface *surface) {
 	if (!f)
 		return Common::Rect();
 
-	Common::Rect rect = f->draw(surface);
-
-	delete f;
-
-	return rect;
+	return f->draw(surface);
 }
 
 bool SequenceFrame::setFrame(uint16 frame) {
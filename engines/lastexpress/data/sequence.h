@@ -75,6 +75,7 @@
 #include "lastexpress/shared.h"
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
 #include "common/str.h"
 
@@ -134,6 +135,9 @@ public:
 	~AnimFrame();
 	Common::Rect draw(Graphics::Surface *s);
 
+	// Returns the memory used by the decoded frame
+	uint32 getSize() const;
+
 private:
 	void decomp3(Common::SeekableReadStream *in, const FrameInfo &f);
 	void decomp4(Common::SeekableReadStream *in, const FrameInfo &f);
@@ -142,17 +146,19 @@ private:
 	void decomp7(Common::SeekableReadStream *in, const FrameInfo &f);
 	void decompFF(Common::SeekableReadStream *in, const FrameInfo &f);
 	void readPalette(Common::SeekableReadStream *in, const FrameInfo &f);
+	void crop();
 
-	Graphics::Surface _image;
+	Graphics::Surface _image;       ///< Decoded pixels inside _drawRect
 	uint16 _palSize;
 	uint16 *_palette;
 	Common::Rect _rect;
+	Common::Rect _drawRect;         ///< Bounding box of the non-transparent pixels
 	bool _ignoreSubtype;
 };
 
 class Sequence {
 public:
-	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15) {}
+	Sequence(Common::String name) : _stream(NULL), _isLoaded(false), _name(name), _field30(15), _frameCacheSize(0), _frameCacheUse(0) {}
 	~Sequence();
 
 	static Sequence *load(Common::String name, Common::SeekableReadStream *stream = NULL, byte field30 = 15);
@@ -160,6 +166,9 @@ public:
 	bool load(Common::SeekableReadStream *stream, byte field30 = 15);
 
 	uint16 count() const { return (uint16)_frames.size(); }
+
+	// The returned frame is owned by the sequence and stays valid until
+	// the next call to getFrame()
 	AnimFrame *getFrame(uint16 index = 0);
 	FrameInfo *getFrameInfo(uint16 index = 0);
 
@@ -172,7 +181,19 @@ private:
 	static const uint32 _sequenceHeaderSize = 8;
 	static const uint32 _sequenceFrameSize = 68;
 
+	// Decoded frames are kept in least recently used order up to this size
+	static const uint32 kFrameCacheMaxSize = 1024 * 1024;
+
+	struct CachedFrame {
+		AnimFrame *frame;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<uint16, CachedFrame> FrameCache;
+
 	void reset();
+	void evictFrames(uint32 size);
+	void clearFrameCache();
 
 	Common::Array<FrameInfo> _frames;
 	Common::SeekableReadStream *_stream;
@@ -180,6 +201,10 @@ private:
 
 	Common::String _name;
 	byte _field30; // used when copying sequences
+
+	FrameCache _frameCache;
+	uint32 _frameCacheSize;
+	uint32 _frameCacheUse;
 };
 
 class SequenceFrame : public Drawable {
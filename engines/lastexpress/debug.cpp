@@ -360,7 +360,6 @@ bool Debugger::cmdShowFrame(int argc, const char **argv) {
 				}
 
 				_engine->getGraphicsManager()->draw(frame, GraphicsManager::kBackgroundOverlay);
-				delete frame;
 
 				askForRedraw();
 				redrawScreen();
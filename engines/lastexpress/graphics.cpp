@@ -70,6 +70,8 @@ void GraphicsManager::clear(BackgroundType type) {
 }
 
 void GraphicsManager::clear(BackgroundType type, const Common::Rect &rect) {
+	addDirtyRect(rect);
+
 	switch (type) {
 		default:
 			error("[GraphicsManager::clear] Unknown background type: %d", type);
@@ -96,12 +98,25 @@ bool GraphicsManager::draw(Drawable *drawable, BackgroundType type, bool transit
 	if (transition)
 		clear(type);
 
-	// TODO store rect for later use
 	Common::Rect rect = drawable->draw(getSurface(type));
 
+	// Some drawables do not report what they have drawn
+	addDirtyRect(rect.isEmpty() ? Common::Rect(640, 480) : rect);
+
 	return (!rect.isEmpty());
 }
 
+void GraphicsManager::addDirtyRect(Common::Rect rect) {
+	rect.clip(640, 480);
+	if (rect.isEmpty())
+		return;
+
+	if (_dirtyRect.isEmpty())
+		_dirtyRect = rect;
+	else
+		_dirtyRect.extend(rect);
+}
+
 Graphics::Surface *GraphicsManager::getSurface(BackgroundType type) {
 	switch (type) {
 		default:
@@ -126,39 +141,40 @@ Graphics::Surface *GraphicsManager::getSurface(BackgroundType type) {
 	}
 }
 
-// TODO optimize to only merge dirty rects
 void GraphicsManager::mergePlanes() {
-	// Clear screen surface
-	_screen.fillRect(Common::Rect(640, 480), 0);
-
-	uint16 *screen = (uint16 *)_screen.pixels;
-	uint16 *inventory = (uint16 *)_inventory.pixels;
-	uint16 *overlay = (uint16 *)_overlay.pixels;
-	uint16 *backgroundC = (uint16 *)_backgroundC.pixels;
-	uint16 *backgroundA = (uint16 *)_backgroundA.pixels;
-
-	for (int i = 0; i < 640 * 480; i++) {
-
-		if (*inventory != COLOR_KEY)
-			*screen = *inventory;
-		else if (*overlay != COLOR_KEY)
-			*screen = *overlay;
-		else if (*backgroundA != COLOR_KEY)
-			*screen = *backgroundA;
-		else if (*backgroundC != COLOR_KEY)
-			*screen = *backgroundC;
-		else
-			*screen = 0;
-
-		inventory++;
-		screen++;
-		overlay++;
-		backgroundA++;
-		backgroundC++;
+	// Only the parts of the planes changed since the last merge need to be
+	// merged again, the rest of the screen surface is still up to date
+	if (_dirtyRect.isEmpty())
+		return;
+
+	const int16 width = _dirtyRect.width();
+
+	for (int16 y = _dirtyRect.top; y < _dirtyRect.bottom; y++) {
+		uint16 *screen = (uint16 *)_screen.getBasePtr(_dirtyRect.left, y);
+		const uint16 *inventory = (const uint16 *)_inventory.getBasePtr(_dirtyRect.left, y);
+		const uint16 *overlay = (const uint16 *)_overlay.getBasePtr(_dirtyRect.left, y);
+		const uint16 *backgroundC = (const uint16 *)_backgroundC.getBasePtr(_dirtyRect.left, y);
+		const uint16 *backgroundA = (const uint16 *)_backgroundA.getBasePtr(_dirtyRect.left, y);
+
+		for (int16 x = 0; x < width; x++) {
+			if (inventory[x] != COLOR_KEY)
+				screen[x] = inventory[x];
+			else if (overlay[x] != COLOR_KEY)
+				screen[x] = overlay[x];
+			else if (backgroundA[x] != COLOR_KEY)
+				screen[x] = backgroundA[x];
+			else if (backgroundC[x] != COLOR_KEY)
+				screen[x] = backgroundC[x];
+			else
+				screen[x] = 0;
+		}
 	}
+
+	_dirtyRect = Common::Rect();
 }
 
 void GraphicsManager::updateScreen() {
+	// Animations draw directly to the screen, so it is always fully refreshed
 	g_system->fillScreen(0);
 	g_system->copyRectToScreen(_screen.getBasePtr(0, 0), 640 * 2, 0, 0, 640, 480);
 }
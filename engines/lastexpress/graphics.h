@@ -25,6 +25,8 @@
 
 #include "lastexpress/drawable.h"
 
+#include "common/rect.h"
+
 namespace LastExpress {
 
 class GraphicsManager {
@@ -63,9 +65,11 @@ private:
 
 	void mergePlanes();
 	void updateScreen();
+	void addDirtyRect(Common::Rect rect);
 	Graphics::Surface *getSurface(BackgroundType type);
 
 	bool _changed;
+	Common::Rect _dirtyRect;        // Area of the planes changed since the last merge
 };
 
 } // End of namespace LastExpress
@@ -68,7 +68,7 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() : _cacheSize(0), _cacheUseCounter(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -76,8 +76,8 @@ GraphicsManager::~GraphicsManager() {
 }
 
 void GraphicsManager::clearCache() {
-	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++)
-		delete it->_value;
+	for (ImageCache::iterator it = _cache.begin(); it != _cache.end(); it++)
+		delete it->_value.surface;
 	for (Common::HashMap<uint16, Common::Array<MohawkSurface *> >::iterator it = _subImageCache.begin(); it != _subImageCache.end(); it++) {
 		Common::Array<MohawkSurface *> &array = it->_value;
 		for (uint i = 0; i < array.size(); i++)
@@ -85,19 +85,55 @@ void GraphicsManager::clearCache() {
 	}
 
 	_cache.clear();
+	_cacheSize = 0;
+	_cacheUseCounter = 0;
 	_subImageCache.clear();
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
-	if (!_cache.contains(id))
-		_cache[id] = decodeImage(id);
+	ImageCache::iterator it = _cache.find(id);
+	if (it != _cache.end()) {
+		it->_value.lastUse = ++_cacheUseCounter;
+		return it->_value.surface;
+	}
+
+	CacheEntry entry;
+	entry.surface = decodeImage(id);
+	entry.lastUse = ++_cacheUseCounter;
+	entry.pinned = false;
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// Images stay cached across card changes, so keep the cache bounded.
+	// The pointer returned by the previous call may still be in use, so
+	// eviction only ever happens here, before adding a new image.
+	const uint32 size = getImageSize(entry.surface);
+	evictImages(size);
 
-	return _cache[id];
+	_cache[id] = entry;
+	_cacheSize += size;
+	return entry.surface;
+}
+
+void GraphicsManager::evictImages(uint32 size) {
+	while (_cacheSize + size > kMaxCacheSize) {
+		ImageCache::iterator oldest = _cache.end();
+		for (ImageCache::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (!it->_value.pinned && (oldest == _cache.end() || it->_value.lastUse < oldest->_value.lastUse))
+				oldest = it;
+		}
+
+		// Only pinned images are left
+		if (oldest == _cache.end())
+			return;
+
+		_cacheSize -= getImageSize(oldest->_value.surface);
+		delete oldest->_value.surface;
+		_cache.erase(oldest);
+	}
+}
+
+uint32 GraphicsManager::getImageSize(const MohawkSurface *image) {
+	const Graphics::Surface *surface = image->getSurface();
+	return surface ? surface->h * surface->pitch : 0;
 }
 
 Common::Array<MohawkSurface *> GraphicsManager::decodeImages(uint16 id) {
@@ -227,7 +263,13 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 	if (_cache.contains(id))
 		error("Image %d already in cache", id);
 
-	_cache[id] = surface;
+	CacheEntry entry;
+	entry.surface = surface;
+	entry.lastUse = ++_cacheUseCounter;
+	entry.pinned = true;
+
+	_cache[id] = entry;
+	_cacheSize += getImageSize(surface);
 }
 
 } // End of namespace Mohawk
@@ -72,6 +72,8 @@ public:
 	virtual ~GraphicsManager();
 
 	// Free all surfaces in the cache
+	// Has to be called whenever image ids change meaning, i.e. when
+	// switching to another stack or archive.
 	void clearCache();
 
 	void preloadImage(uint16 image);
@@ -94,11 +96,34 @@ protected:
 	virtual Common::Array<MohawkSurface *> decodeImages(uint16 id);
 
 	virtual MohawkEngine *getVM() = 0;
+
+	// Images added this way are never evicted from the cache
 	void addImageToCache(uint16 id, MohawkSurface *surface);
 
 private:
-	// An image cache that stores images until clearCache() is called
-	Common::HashMap<uint16, MohawkSurface *> _cache;
+	enum {
+		// Maximum size of the decoded images in the cache
+		kMaxCacheSize = 32 * 1024 * 1024
+	};
+
+	struct CacheEntry {
+		MohawkSurface *surface;
+		uint32 lastUse;
+		bool pinned;
+	};
+
+	typedef Common::HashMap<uint16, CacheEntry> ImageCache;
+
+	// Frees the least recently used images until size more bytes fit
+	void evictImages(uint32 size);
+
+	static uint32 getImageSize(const MohawkSurface *image);
+
+	// An image cache that stores decoded images until clearCache() is called
+	// or they are evicted to make room for other images.
+	ImageCache _cache;
+	uint32 _cacheSize;
+	uint32 _cacheUseCounter;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
 };
 
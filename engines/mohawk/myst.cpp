@@ -564,9 +564,8 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 
 	unloadCard();
 
-	// Clear the resource cache and image cache
-	_cache.clear();
-	_gfx->clearCache();
+	// The resource and image caches are bounded in size and kept across
+	// cards, so going back and forth doesn't decode everything again.
 
 	_curCard = card;
 
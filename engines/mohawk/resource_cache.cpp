@@ -26,7 +26,7 @@
 
 namespace Mohawk {
 
-ResourceCache::ResourceCache() {
+ResourceCache::ResourceCache() : _size(0), _useCounter(0) {
 	enabled = true;
 }
 
@@ -40,25 +40,40 @@ void ResourceCache::clear() {
 
 	debugC(kDebugCache, "Clearing Cache...");
 
-	for (uint32 i = 0; i < _store.size(); i++)
-		delete _store[i].data;
+	for (DataMap::iterator i = _store.begin(); i != _store.end(); ++i)
+		delete i->_value.data;
 
 	_store.clear();
+	_size = 0;
+	_useCounter = 0;
 }
 
 void ResourceCache::add(uint32 tag, uint16 id, Common::SeekableReadStream *data) {
 	if (!enabled)
 		return;
 
+	Key key;
+	key.tag = tag;
+	key.id = id;
+
+	if (_store.contains(key))
+		return;
+
 	debugC(kDebugCache, "Adding item %d - tag 0x%04X id %d", _store.size(), tag, id);
 
+	// Don't let a single resource take more than a quarter of the cache
+	if ((uint32)data->size() > kMaxSize / 4)
+		return;
+
+	evict(data->size());
+
 	DataObject current;
-	current.tag = tag;
-	current.id = id;
 	uint32 dataCurPos = data->pos();
 	current.data = data->readStream(data->size());
+	current.lastUse = ++_useCounter;
 	data->seek(dataCurPos);
-	_store.push_back(current);
+	_store[key] = current;
+	_size += current.data->size();
 }
 
 // Returns NULL if not found
@@ -68,18 +83,38 @@ Common::SeekableReadStream *ResourceCache::search(uint32 tag, uint16 id) {
 
 	debugC(kDebugCache, "Searching for tag 0x%04X id %d", tag, id);
 
-	for (uint32 i = 0; i < _store.size(); i++) {
-		if (tag == _store[i].tag && id == _store[i].id) {
-			debugC(kDebugCache, "Found cached tag 0x%04X id %u", tag, id);
-			uint32 dataCurPos  = _store[i].data->pos();
-			Common::SeekableReadStream *ret = _store[i].data->readStream(_store[i].data->size());
-			_store[i].data->seek(dataCurPos);
-			return ret;
-		}
+	Key key;
+	key.tag = tag;
+	key.id = id;
+
+	DataMap::iterator i = _store.find(key);
+	if (i != _store.end()) {
+		debugC(kDebugCache, "Found cached tag 0x%04X id %u", tag, id);
+		DataObject &current = i->_value;
+		current.lastUse = ++_useCounter;
+		uint32 dataCurPos  = current.data->pos();
+		Common::SeekableReadStream *ret = current.data->readStream(current.data->size());
+		current.data->seek(dataCurPos);
+		return ret;
 	}
 
 	debugC(kDebugCache, "tag 0x%04X id %d not found", tag, id);
 	return NULL;
 }
 
+void ResourceCache::evict(uint32 size) {
+	while (!_store.empty() && _size + size > kMaxSize) {
+		DataMap::iterator oldest = _store.begin();
+		for (DataMap::iterator i = _store.begin(); i != _store.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+
+		debugC(kDebugCache, "Evicting tag 0x%04X id %d", oldest->_key.tag, oldest->_key.id);
+		_size -= oldest->_value.data->size();
+		delete oldest->_value.data;
+		_store.erase(oldest);
+	}
+}
+
 } // End of namespace Mohawk
@@ -23,11 +23,17 @@
 #ifndef RESOURCE_CACHE_H
 #define RESOURCE_CACHE_H
 
-#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/stream.h"
 
 namespace Mohawk {
 
+/**
+ * Cache of raw resource data.
+ *
+ * Entries are evicted in least recently used order once the total size
+ * of the cached data exceeds kMaxSize.
+ */
 class ResourceCache {
 public:
 	ResourceCache();
@@ -42,13 +48,35 @@ public:
 	Common::SeekableReadStream *search(uint32 tag, uint16 id);
 
 private:
+	enum {
+		kMaxSize = 8 * 1024 * 1024
+	};
+
 	struct DataObject {
+		Common::SeekableReadStream *data;
+		uint32 lastUse;
+	};
+
+	struct Key {
 		uint32 tag;
 		uint16 id;
-		Common::SeekableReadStream *data;
 	};
 
-	Common::Array<DataObject> _store;
+	struct KeyHash {
+		uint operator()(const Key &key) const { return key.tag * 31 + key.id; }
+	};
+
+	struct KeyEqualTo {
+		bool operator()(const Key &a, const Key &b) const { return a.tag == b.tag && a.id == b.id; }
+	};
+
+	typedef Common::HashMap<Key, DataObject, KeyHash, KeyEqualTo> DataMap;
+
+	void evict(uint32 size);
+
+	DataMap _store;
+	uint32 _size;
+	uint32 _useCounter;
 };
 
 } // End of namespace Mohawk
@@ -22,6 +22,7 @@
 
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/profiler.h"
 
 #include "sci/sci.h"
 #include "sci/console.h"
@@ -531,6 +532,9 @@ int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4])
 void run_vm(EngineState *s) {
 	assert(s);
 
+	PROFILE_ZONE("SCI vm");
+	PROFILE_COUNTER("SCI vm steps", s->scriptStepCounter);
+
 	int temp;
 	reg_t r_temp; // Temporary register
 	StackPtr s_temp; // Temporary stack pointer
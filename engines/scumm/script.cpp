@@ -21,6 +21,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -884,6 +885,8 @@ void ScummEngine::unfreezeScripts() {
 
 
 void ScummEngine::runAllScripts() {
+	PROFILE_ZONE("SCUMM scripts");
+
 	int i;
 
 	for (i = 0; i < NUM_SCRIPT_SLOT; i++)
@@ -333,6 +333,25 @@ Common::File *ResMan::resFile(uint32 id) {
 			}
 			_openClus--;
 		}
+	} else if (cluster != _openCluEnd) {
+		// Keep the list in least recently used order, so that the
+		// clusters which are closed first are the ones not used lately
+		Clu *prev = NULL;
+		Clu *cur = _openCluStart;
+		while (cur != cluster) {
+			prev = cur;
+			cur = cur->nextOpen;
+			assert(cur);
+		}
+
+		if (prev)
+			prev->nextOpen = cluster->nextOpen;
+		else
+			_openCluStart = cluster->nextOpen;
+
+		cluster->nextOpen = NULL;
+		_openCluEnd->nextOpen = cluster;
+		_openCluEnd = cluster;
 	}
 	return cluster->file;
 }
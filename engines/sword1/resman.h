@@ -122,7 +122,7 @@ private:
 	MemMan *_memMan;
 	static const uint32 _scriptList[TOTAL_SECTIONS];    //a table of resource tags
 	static uint32 _srIdList[29];
-	Clu *_openCluStart, *_openCluEnd;
+	Clu *_openCluStart, *_openCluEnd; // open clusters, least recently used first
 	int  _openClus;
 	bool _isBigEndian;
 };
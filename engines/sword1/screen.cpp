@@ -57,6 +57,8 @@ Screen::Screen(OSystem *system, ResMan *pResMan, ObjectMan *pObjMan) {
 	_psxCache.extPlxCache = NULL;
 	_oldScrollX = 0;
 	_oldScrollY = 0;
+	_frameCacheSize = 0;
+	_frameCacheUseCounter = 0;
 }
 
 Screen::~Screen() {
@@ -64,6 +66,7 @@ Screen::~Screen() {
 	free(_screenGrid);
 	if (_currentScreen != 0xFFFF)
 		quitScreen();
+	flushFrameCache();
 }
 
 void Screen::clearScreen() {
@@ -346,6 +349,7 @@ void Screen::quitScreen() {
 	uint8 cnt;
 	if (SwordEngine::isPsx())
 		flushPsxCache();
+	flushFrameCache();
 	for (cnt = 0; cnt < _roomDefTable[_currentScreen].totalLayers; cnt++)
 		_resMan->resClose(_roomDefTable[_currentScreen].layers[cnt]);
 	for (cnt = 0; cnt < _roomDefTable[_currentScreen].totalLayers - 1; cnt++)
@@ -467,9 +471,21 @@ void Screen::processImage(uint32 id) {
 		spriteY += (int16)_resMan->readUint16(&frameHead->offsetY);
 	}
 
+	// Decoded (and shrunk) frames of objects are cached, text sprites are
+	// rendered at run-time and can change with every frame
+	FrameCacheKey cacheKey;
+	cacheKey.resId = compact->o_resource;
+	cacheKey.frameNo = compact->o_frame;
+	cacheKey.scale = (compact->o_status & STAT_SHRINK) ? scale : -1;
+	const bool cacheable = (compact->o_type != TYPE_TEXT);
+	uint8 *cachedData = cacheable ? findCachedFrame(cacheKey) : NULL;
+	const uint8 *rawData = sprData;
+
 	uint8 *tonyBuf = NULL;
 	uint8 *hifBuf = NULL;
-	if (SwordEngine::isPsx() && compact->o_type != TYPE_TEXT) { // PSX sprites are compressed with HIF
+	if (cachedData) {
+		sprData = cachedData;
+	} else if (SwordEngine::isPsx() && compact->o_type != TYPE_TEXT) { // PSX sprites are compressed with HIF
 		hifBuf = (uint8 *)malloc(_resMan->readUint16(&frameHead->width) * _resMan->readUint16(&frameHead->height) / 2);
 		memset(hifBuf, 0x00, (_resMan->readUint16(&frameHead->width) * _resMan->readUint16(&frameHead->height) / 2));
 		decompressHIF(sprData, hifBuf);
@@ -488,21 +504,26 @@ void Screen::processImage(uint32 id) {
 
 	uint16 sprSizeX, sprSizeY;
 	if (compact->o_status & STAT_SHRINK) {
-		memset(_shrinkBuffer, 0, SHRINK_BUFFER_SIZE); //Clean shrink buffer to avoid corruption
+		if (!cachedData)
+			memset(_shrinkBuffer, 0, SHRINK_BUFFER_SIZE); //Clean shrink buffer to avoid corruption
 		if (SwordEngine::isPsx() && (compact->o_resource != GEORGE_MEGA)) { //PSX Height shrinked sprites
 			sprSizeX = (scale * _resMan->readUint16(&frameHead->width)) / 256;
 			sprSizeY = (scale * (_resMan->readUint16(&frameHead->height))) / 256 / 2;
-			fastShrink(sprData, _resMan->readUint16(&frameHead->width), (_resMan->readUint16(&frameHead->height)) / 2, scale, _shrinkBuffer);
+			if (!cachedData)
+				fastShrink(sprData, _resMan->readUint16(&frameHead->width), (_resMan->readUint16(&frameHead->height)) / 2, scale, _shrinkBuffer);
 		} else if (SwordEngine::isPsx()) { //PSX width/height shrinked sprites
 			sprSizeX = (scale * _resMan->readUint16(&frameHead->width)) / 256 / 2;
 			sprSizeY = (scale * _resMan->readUint16(&frameHead->height)) / 256 / 2;
-			fastShrink(sprData, _resMan->readUint16(&frameHead->width) / 2, _resMan->readUint16(&frameHead->height) / 2, scale, _shrinkBuffer);
+			if (!cachedData)
+				fastShrink(sprData, _resMan->readUint16(&frameHead->width) / 2, _resMan->readUint16(&frameHead->height) / 2, scale, _shrinkBuffer);
 		} else {
 			sprSizeX = (scale * _resMan->readUint16(&frameHead->width)) / 256;
 			sprSizeY = (scale * _resMan->readUint16(&frameHead->height)) / 256;
-			fastShrink(sprData, _resMan->readUint16(&frameHead->width), _resMan->readUint16(&frameHead->height), scale, _shrinkBuffer);
+			if (!cachedData)
+				fastShrink(sprData, _resMan->readUint16(&frameHead->width), _resMan->readUint16(&frameHead->height), scale, _shrinkBuffer);
 		}
-		sprData = _shrinkBuffer;
+		if (!cachedData)
+			sprData = _shrinkBuffer;
 	} else {
 		sprSizeX = _resMan->readUint16(&frameHead->width);
 		if (SwordEngine::isPsx()) { //PSX sprites are half height
@@ -511,6 +532,11 @@ void Screen::processImage(uint32 id) {
 			sprSizeY = (_resMan->readUint16(&frameHead->height));
 	}
 
+	// Uncompressed frames are drawn straight from the resource, there's
+	// nothing to gain from caching those
+	if (cacheable && !cachedData && sprData != rawData)
+		addCachedFrame(cacheKey, sprData, sprSizeX * sprSizeY);
+
 	if (!(compact->o_status & STAT_OVERRIDE)) {
 		//mouse size linked to exact size & coordinates of sprite box - shrink friendly
 		if (_resMan->readUint16(&frameHead->offsetX) || _resMan->readUint16(&frameHead->offsetY)) {
@@ -554,6 +580,48 @@ void Screen::processImage(uint32 id) {
 	free(hifBuf);
 }
 
+uint8 *Screen::findCachedFrame(const FrameCacheKey &key) {
+	FrameCache::iterator it = _frameCache.find(key);
+	if (it == _frameCache.end())
+		return NULL;
+
+	it->_value.lastUse = ++_frameCacheUseCounter;
+	return it->_value.data;
+}
+
+void Screen::addCachedFrame(const FrameCacheKey &key, const uint8 *data, uint32 size) {
+	if (!size || size > FRAME_CACHE_SIZE / 4)
+		return;
+
+	// Evict the least recently used frames until the new one fits
+	while (!_frameCache.empty() && _frameCacheSize + size > FRAME_CACHE_SIZE) {
+		FrameCache::iterator oldest = _frameCache.begin();
+		for (FrameCache::iterator it = _frameCache.begin(); it != _frameCache.end(); ++it)
+			if (it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+
+		_frameCacheSize -= oldest->_value.size;
+		free(oldest->_value.data);
+		_frameCache.erase(oldest);
+	}
+
+	FrameCacheEntry entry;
+	entry.data = (uint8 *)malloc(size);
+	memcpy(entry.data, data, size);
+	entry.size = size;
+	entry.lastUse = ++_frameCacheUseCounter;
+	_frameCache[key] = entry;
+	_frameCacheSize += size;
+}
+
+void Screen::flushFrameCache() {
+	for (FrameCache::iterator it = _frameCache.begin(); it != _frameCache.end(); ++it)
+		free(it->_value.data);
+	_frameCache.clear();
+	_frameCacheSize = 0;
+	_frameCacheUseCounter = 0;
+}
+
 void Screen::verticalMask(uint16 x, uint16 y, uint16 bWidth, uint16 bHeight) {
 	if (_roomDefTable[_currentScreen].totalLayers <= 1)
 		return;
@@ -25,6 +25,8 @@
 
 #include "sword1/sworddefs.h"
 
+#include "common/hashmap.h"
+
 class OSystem;
 
 namespace Sword1 {
@@ -57,6 +59,7 @@ struct PSXDataCache { // Cache for PSX screen, to avoid decompressing background
 #define SCRNGRID_Y 8
 #define SHRINK_BUFFER_SIZE 50000
 #define RLE_BUFFER_SIZE 50000
+#define FRAME_CACHE_SIZE (2 * 1024 * 1024)
 
 #define FLASH_RED 0
 #define FLASH_BLUE 1
@@ -130,6 +133,37 @@ private:
 
 	void flushPsxCache();
 
+	// Cache of decoded sprite frames, flushed on every room change
+	struct FrameCacheKey {
+		uint32 resId;
+		uint32 frameNo;
+		int scale; // -1 for frames which aren't shrunk
+	};
+
+	struct FrameCacheKeyHash {
+		uint operator()(const FrameCacheKey &key) const {
+			return key.resId * 31 * 31 + key.frameNo * 31 + key.scale;
+		}
+	};
+
+	struct FrameCacheKeyEqualTo {
+		bool operator()(const FrameCacheKey &a, const FrameCacheKey &b) const {
+			return a.resId == b.resId && a.frameNo == b.frameNo && a.scale == b.scale;
+		}
+	};
+
+	struct FrameCacheEntry {
+		uint8 *data;
+		uint32 size;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<FrameCacheKey, FrameCacheEntry, FrameCacheKeyHash, FrameCacheKeyEqualTo> FrameCache;
+
+	uint8 *findCachedFrame(const FrameCacheKey &key);
+	void addCachedFrame(const FrameCacheKey &key, const uint8 *data, uint32 size);
+	void flushFrameCache();
+
 	OSystem *_system;
 	ResMan *_resMan;
 	ObjectMan *_objMan;
@@ -149,6 +183,10 @@ private:
 
 	PSXDataCache _psxCache; // Cache used for PSX backgrounds
 
+	FrameCache _frameCache;
+	uint32 _frameCacheSize;
+	uint32 _frameCacheUseCounter;
+
 	uint32  _foreList[MAX_FORE];
 	uint32  _backList[MAX_BACK];
 	SortSpr _sortList[MAX_SORT];
@@ -109,22 +109,55 @@ void Screen::scaleImageFast(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16
 }
 
 void Screen::scaleImageGood(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16 dstHeight, byte *src, uint16 srcPitch, uint16 srcWidth, uint16 srcHeight, byte *backBuf, int16 bbXPos, int16 bbYPos) {
-	for (int y = 0; y < dstHeight; y++) {
-		for (int x = 0; x < dstWidth; x++) {
-			uint8 c1, c2, c3, c4;
+	int x, y;
+
+	// Step through the source image incrementally to get the source
+	// position and the weight of the first neighbour of every column
+	// and row, instead of dividing for each pixel.
+	uint32 pos = 0, rem = 0;
+	for (x = 0; x < dstWidth; x++) {
+		_xScale[x] = pos;
+		_xFrac[x] = dstWidth - rem;
+		rem += srcWidth;
+		while (rem >= dstWidth) {
+			rem -= dstWidth;
+			pos++;
+		}
+	}
+
+	pos = rem = 0;
+	for (y = 0; y < dstHeight; y++) {
+		_yScale[y] = pos;
+		_yFrac[y] = dstHeight - rem;
+		rem += srcHeight;
+		while (rem >= dstHeight) {
+			rem -= dstHeight;
+			pos++;
+		}
+	}
 
-			uint32 xPos = (x * srcWidth) / dstWidth;
-			uint32 yPos = (y * srcHeight) / dstHeight;
-			uint32 xFrac = dstWidth - (x * srcWidth) % dstWidth;
-			uint32 yFrac = dstHeight - (y * srcHeight) % dstHeight;
+	for (y = 0; y < dstHeight; y++) {
+		const byte *srcRow = src + _yScale[y] * srcPitch;
+		const uint32 yFrac = _yFrac[y];
+		const bool lastRow = (y == dstHeight - 1);
+		byte *dstRow = dst + y * dstWidth;
 
-			byte *srcPtr = src + yPos * srcPitch + xPos;
+		for (x = 0; x < dstWidth; x++) {
+			const byte *srcPtr = srcRow + _xScale[x];
+			const bool lastColumn = (x == dstWidth - 1);
+
+			// Nothing to blend if none of the neighbours is part of
+			// the sprite
+			if (!srcPtr[0] && (lastColumn || !srcPtr[1]) && (lastRow || !srcPtr[srcPitch]) &&
+			    (lastColumn || lastRow || !srcPtr[srcPitch + 1])) {
+				dstRow[x] = 0;
+				continue;
+			}
 
-			bool transparent = true;
+			uint8 c1, c2, c3, c4;
 
 			if (*srcPtr) {
 				c1 = *srcPtr;
-				transparent = false;
 			} else {
 				if (bbXPos + x >= 0 &&
 				    bbXPos + x < RENDERWIDE &&
@@ -136,10 +169,9 @@ void Screen::scaleImageGood(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16
 				}
 			}
 
-			if (x < dstWidth - 1) {
+			if (!lastColumn) {
 				if (*(srcPtr + 1)) {
 					c2 = *(srcPtr + 1);
-					transparent = false;
 				} else {
 					if (bbXPos + x + 1 >= 0 &&
 					    bbXPos + x + 1 < RENDERWIDE &&
@@ -154,10 +186,9 @@ void Screen::scaleImageGood(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16
 				c2 = c1;
 			}
 
-			if (y < dstHeight - 1) {
+			if (!lastRow) {
 				if (*(srcPtr + srcPitch)) {
 					c3 = *(srcPtr + srcPitch);
-					transparent = false;
 				} else {
 					if (bbXPos + x >= 0 &&
 					    bbXPos + x < RENDERWIDE &&
@@ -172,10 +203,9 @@ void Screen::scaleImageGood(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16
 				c3 = c1;
 			}
 
-			if (x < dstWidth - 1 && y < dstHeight - 1) {
+			if (!lastColumn && !lastRow) {
 				if (*(srcPtr + srcPitch + 1)) {
 					c4 = *(srcPtr + srcPitch + 1);
-					transparent = false;
 				} else {
 					if (bbXPos + x + 1 >= 0 &&
 					    bbXPos + x + 1 < RENDERWIDE &&
@@ -190,38 +220,37 @@ void Screen::scaleImageGood(byte *dst, uint16 dstPitch, uint16 dstWidth, uint16
 				c4 = c3;
 			}
 
-			if (!transparent) {
-				uint32 r1 = _palette[c1 * 3 + 0];
-				uint32 g1 = _palette[c1 * 3 + 1];
-				uint32 b1 = _palette[c1 * 3 + 2];
+			const uint32 xFrac = _xFrac[x];
+
+			uint32 r1 = _palette[c1 * 3 + 0];
+			uint32 g1 = _palette[c1 * 3 + 1];
+			uint32 b1 = _palette[c1 * 3 + 2];
 
-				uint32 r2 = _palette[c2 * 3 + 0];
-				uint32 g2 = _palette[c2 * 3 + 1];
-				uint32 b2 = _palette[c2 * 3 + 2];
+			uint32 r2 = _palette[c2 * 3 + 0];
+			uint32 g2 = _palette[c2 * 3 + 1];
+			uint32 b2 = _palette[c2 * 3 + 2];
 
-				uint32 r3 = _palette[c3 * 3 + 0];
-				uint32 g3 = _palette[c3 * 3 + 1];
-				uint32 b3 = _palette[c3 * 3 + 2];
+			uint32 r3 = _palette[c3 * 3 + 0];
+			uint32 g3 = _palette[c3 * 3 + 1];
+			uint32 b3 = _palette[c3 * 3 + 2];
 
-				uint32 r4 = _palette[c4 * 3 + 0];
-				uint32 g4 = _palette[c4 * 3 + 1];
-				uint32 b4 = _palette[c4 * 3 + 2];
+			uint32 r4 = _palette[c4 * 3 + 0];
+			uint32 g4 = _palette[c4 * 3 + 1];
+			uint32 b4 = _palette[c4 * 3 + 2];
 
-				uint32 r5 = (r1 * xFrac + r2 * (dstWidth - xFrac)) / dstWidth;
-				uint32 g5 = (g1 * xFrac + g2 * (dstWidth - xFrac)) / dstWidth;
-				uint32 b5 = (b1 * xFrac + b2 * (dstWidth - xFrac)) / dstWidth;
+			uint32 r5 = (r1 * xFrac + r2 * (dstWidth - xFrac)) / dstWidth;
+			uint32 g5 = (g1 * xFrac + g2 * (dstWidth - xFrac)) / dstWidth;
+			uint32 b5 = (b1 * xFrac + b2 * (dstWidth - xFrac)) / dstWidth;
 
-				uint32 r6 = (r3 * xFrac + r4 * (dstWidth - xFrac)) / dstWidth;
-				uint32 g6 = (g3 * xFrac + g4 * (dstWidth - xFrac)) / dstWidth;
-				uint32 b6 = (b3 * xFrac + b4 * (dstWidth - xFrac)) / dstWidth;
+			uint32 r6 = (r3 * xFrac + r4 * (dstWidth - xFrac)) / dstWidth;
+			uint32 g6 = (g3 * xFrac + g4 * (dstWidth - xFrac)) / dstWidth;
+			uint32 b6 = (b3 * xFrac + b4 * (dstWidth - xFrac)) / dstWidth;
 
-				uint32 r = (r5 * yFrac + r6 * (dstHeight - yFrac)) / dstHeight;
-				uint32 g = (g5 * yFrac + g6 * (dstHeight - yFrac)) / dstHeight;
-				uint32 b = (b5 * yFrac + b6 * (dstHeight - yFrac)) / dstHeight;
+			uint32 r = (r5 * yFrac + r6 * (dstHeight - yFrac)) / dstHeight;
+			uint32 g = (g5 * yFrac + g6 * (dstHeight - yFrac)) / dstHeight;
+			uint32 b = (b5 * yFrac + b6 * (dstHeight - yFrac)) / dstHeight;
 
-				dst[y * dstWidth + x] = quickMatch(r, g, b);
-			} else
-				dst[y * dstWidth + x] = 0;
+			dstRow[x] = quickMatch(r, g, b);
 		}
 	}
 }
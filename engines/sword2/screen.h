@@ -340,6 +340,8 @@ private:
 
 	uint16 _xScale[SCALE_MAXWIDTH];
 	uint16 _yScale[SCALE_MAXHEIGHT];
+	uint16 _xFrac[SCALE_MAXWIDTH];
+	uint16 _yFrac[SCALE_MAXHEIGHT];
 
 	void blitBlockSurface(BlockSurface *s, Common::Rect *r, Common::Rect *clipRect);
 
@@ -751,13 +751,23 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 		src = sprite + rs.top * srcPitch + rs.left;
 		lightMap = _lightMask + (rd.top + _scrollY - MENUDEEP) * _locationWide + rd.left + _scrollX;
 
+		// Neighbouring pixels usually share both their color and their
+		// light level, so remember the last match
+		byte lastColor = 0, lastLight = 0, lastMatch = 0;
+
 		for (i = 0; i < rs.height(); i++) {
 			for (j = 0; j < rs.width(); j++) {
 				if (src[j] && lightMap[j]) {
-					uint8 r = ((32 - lightMap[j]) * _palette[src[j] * 3 + 0]) >> 5;
-					uint8 g = ((32 - lightMap[j]) * _palette[src[j] * 3 + 1]) >> 5;
-					uint8 b = ((32 - lightMap[j]) * _palette[src[j] * 3 + 2]) >> 5;
-					src[j] = quickMatch(r, g, b);
+					if (src[j] != lastColor || lightMap[j] != lastLight) {
+						lastColor = src[j];
+						lastLight = lightMap[j];
+
+						uint8 r = ((32 - lightMap[j]) * _palette[src[j] * 3 + 0]) >> 5;
+						uint8 g = ((32 - lightMap[j]) * _palette[src[j] * 3 + 1]) >> 5;
+						uint8 b = ((32 - lightMap[j]) * _palette[src[j] * 3 + 2]) >> 5;
+						lastMatch = quickMatch(r, g, b);
+					}
+					src[j] = lastMatch;
 				}
 			}
 			src += srcPitch;
@@ -31,6 +31,8 @@ Debugger::Debugger() : GUI::Debugger() {
 	DCmd_Register("continue",		WRAP_METHOD(Debugger, Cmd_Exit));
 	DCmd_Register("scene",			WRAP_METHOD(Debugger, Cmd_Scene));
 	DCmd_Register("dirty_rects",	WRAP_METHOD(Debugger, Cmd_DirtyRects));
+	DCmd_Register("ot_stats",		WRAP_METHOD(Debugger, Cmd_OTStats));
+	DCmd_Register("mpal_memory",	WRAP_METHOD(Debugger, Cmd_MpalMemory));
 }
 
 static int strToInt(const char *s) {
@@ -126,4 +128,26 @@ bool Debugger::Cmd_DirtyRects(int argc, const char **argv) {
 	}
 }
 
+/**
+ * Shows the number of primitives in the OT list of the screen buffer
+ */
+bool Debugger::Cmd_OTStats(int argc, const char **argv) {
+	RMGfxTargetBuffer &bigBuf = *g_vm->getEngine();
+
+	DebugPrintf("Primitives drawn last frame: %d\n", bigBuf.getOTDrawn());
+	DebugPrintf("Primitives in the OT list: %d (%d priorities)\n", bigBuf.getOTSize(), bigBuf.getOTPriorities());
+	return true;
+}
+
+/**
+ * Shows the memory used by the MPAL data
+ */
+bool Debugger::Cmd_MpalMemory(int argc, const char **argv) {
+	const MPAL::MemoryStats &stats = MPAL::MemoryManager::getStats();
+
+	DebugPrintf("Blocks: %d (%d from pools)\n", stats._numBlocks, stats._numPooledBlocks);
+	DebugPrintf("Size: %d bytes, peak %d bytes\n", stats._size, stats._peakSize);
+	return true;
+}
+
 } // End of namespace Tony
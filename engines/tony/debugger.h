@@ -36,6 +36,8 @@ public:
 protected:
 	bool Cmd_Scene(int argc, const char **argv);
 	bool Cmd_DirtyRects(int argc, const char **argv);
+	bool Cmd_OTStats(int argc, const char **argv);
+	bool Cmd_MpalMemory(int argc, const char **argv);
 };
 
 } // End of namespace Tony
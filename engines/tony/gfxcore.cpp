@@ -250,12 +250,21 @@ RMGfxWoodyBuffer::RMGfxWoodyBuffer(int dimx, int dimy)
 
 RMGfxTargetBuffer::RMGfxTargetBuffer() {
 	_otlist = NULL;
+	_otLast = NULL;
+	_otFree = NULL;
 	_otSize = 0;
+	_otDrawn = 0;
 	_trackDirtyRects = false;
 }
 
 RMGfxTargetBuffer::~RMGfxTargetBuffer() {
 	clearOT();
+
+	while (_otFree != NULL) {
+		OTList *n = _otFree->_next;
+		delete _otFree;
+		_otFree = n;
+	}
 }
 
 void RMGfxTargetBuffer::clearOT() {
@@ -267,17 +276,23 @@ void RMGfxTargetBuffer::clearOT() {
 		cur->_prim->_task->unregister();
 		delete cur->_prim;
 		n = cur->_next;
-		delete cur;
+
+		// Keep the item around for the next frame
+		cur->_next = _otFree;
+		_otFree = cur;
+
 		cur = n;
 	}
 
 	_otlist = NULL;
+	_otLast = NULL;
+	_otBuckets.resize(0);	// Keep the storage for the next frame
+	_otSize = 0;
 }
 
 void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
 	CORO_BEGIN_CONTEXT;
 	OTList *cur;
-	OTList *prev;
 	OTList *next;
 	RMGfxPrimitive *myprim;
 	bool result;
@@ -285,7 +300,7 @@ void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
 
 	CORO_BEGIN_CODE(_ctx);
 
-	_ctx->prev = NULL;
+	_otDrawn = 0;
 	_ctx->cur = _otlist;
 
 	while (_ctx->cur != NULL) {
@@ -293,31 +308,21 @@ void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
 		_ctx->myprim = _ctx->cur->_prim->duplicate();
 		CORO_INVOKE_2(_ctx->cur->_prim->_task->draw, *this, _ctx->myprim);
 		delete _ctx->myprim;
+		_otDrawn++;
 
 		// Check if it's time to remove the task from the OT list
 		CORO_INVOKE_1(_ctx->cur->_prim->_task->removeThis, _ctx->result);
+		_ctx->next = _ctx->cur->_next;
 		if (_ctx->result) {
 			// De-register the task
 			_ctx->cur->_prim->_task->unregister();
 
 			// Delete task, freeing the memory
 			delete _ctx->cur->_prim;
-			_ctx->next = _ctx->cur->_next;
-			delete _ctx->cur;
-
-			// If it was the first item, update the list head
-			if (_ctx->prev == NULL)
-				_otlist = _ctx->next;
-			// Otherwise update the next pinter of the previous item
-			else
-				_ctx->prev->_next = _ctx->next;
-
-			_ctx->cur = _ctx->next;
-		} else {
-			// Update the pointer to the previous item, and the current to the next
-			_ctx->prev = _ctx->cur;
-			_ctx->cur = _ctx->cur->_next;
+			removeOTItem(_ctx->cur);
 		}
+
+		_ctx->cur = _ctx->next;
 	}
 
 	CORO_END_CODE;
@@ -325,32 +330,109 @@ void RMGfxTargetBuffer::drawOT(CORO_PARAM) {
 
 void RMGfxTargetBuffer::addPrim(RMGfxPrimitive *prim) {
 	int nPrior;
-	OTList *cur, *n;
+	OTList *n, *next;
 
 	// Warn of the OT listing
 	prim->_task->Register();
 
 	// Check the priority
 	nPrior = prim->_task->priority();
-	n = new OTList(prim);
+	n = allocOTItem();
+	n->_prim = prim;
+	n->_nPrior = nPrior;
+
+	// Find the item to insert the new one in front of. Items are sorted by
+	// priority, and a new item goes in front of the items with the same
+	// priority, except for the first one in the list.
+	uint i = findOTBucket(nPrior);
+	if (i == _otBuckets.size()) {
+		next = NULL;
+	} else if (_otBuckets[i]._nPrior != nPrior) {
+		next = _otBuckets[i]._first;
+	} else if (i == 0) {
+		next = _otBuckets[i]._first->_next;
+	} else {
+		next = _otBuckets[i]._first;
+	}
 
-	// Empty list
-	if (_otlist == NULL) {
-		_otlist = n;
-		_otlist->_next = NULL;
+	// Link the new item
+	n->_next = next;
+	if (next != NULL) {
+		n->_prev = next->_prev;
+		next->_prev = n;
+	} else {
+		n->_prev = _otLast;
+		_otLast = n;
 	}
-	// Inclusion in the head
-	else if (nPrior < _otlist->_prim->_task->priority()) {
-		n->_next = _otlist;
+
+	if (n->_prev != NULL)
+		n->_prev->_next = n;
+	else
 		_otlist = n;
-	} else {
-		cur = _otlist;
-		while (cur->_next != NULL && nPrior > cur->_next->_prim->_task->priority())
-			cur = cur->_next;
 
-		n->_next = cur->_next;
-		cur->_next = n;
+	// Update the first item of the priority
+	if (i == _otBuckets.size() || _otBuckets[i]._nPrior != nPrior) {
+		OTBucket bucket;
+		bucket._nPrior = nPrior;
+		bucket._first = n;
+		_otBuckets.insert_at(i, bucket);
+	} else if (i != 0) {
+		_otBuckets[i]._first = n;
 	}
+
+	_otSize++;
+}
+
+RMGfxTargetBuffer::OTList *RMGfxTargetBuffer::allocOTItem() {
+	if (_otFree == NULL)
+		return new OTList;
+
+	OTList *n = _otFree;
+	_otFree = n->_next;
+	return n;
+}
+
+void RMGfxTargetBuffer::removeOTItem(OTList *item) {
+	// Update the first item of the priority
+	uint i = findOTBucket(item->_nPrior);
+	assert(i < _otBuckets.size() && _otBuckets[i]._nPrior == item->_nPrior);
+	if (_otBuckets[i]._first == item) {
+		if (item->_next != NULL && item->_next->_nPrior == item->_nPrior)
+			_otBuckets[i]._first = item->_next;
+		else
+			_otBuckets.remove_at(i);
+	}
+
+	// Unlink the item
+	if (item->_prev != NULL)
+		item->_prev->_next = item->_next;
+	else
+		_otlist = item->_next;
+	if (item->_next != NULL)
+		item->_next->_prev = item->_prev;
+	else
+		_otLast = item->_prev;
+
+	item->_next = _otFree;
+	_otFree = item;
+	_otSize--;
+}
+
+/**
+ * Returns the index of the first bucket with a priority greater than or
+ * equal to the given one
+ */
+uint RMGfxTargetBuffer::findOTBucket(int nPrior) {
+	uint lo = 0, hi = _otBuckets.size();
+	while (lo < hi) {
+		uint mid = (lo + hi) / 2;
+		if (_otBuckets[mid]._nPrior < nPrior)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
 }
 
 void RMGfxTargetBuffer::addDirtyRect(const Common::Rect &r) {
@@ -29,6 +29,7 @@
 #ifndef TONY_GFXCORE_H
 #define TONY_GFXCORE_H
 
+#include "common/array.h"
 #include "common/system.h"
 #include "common/coroutines.h"
 #include "tony/utils.h"
@@ -436,11 +437,16 @@ private:
 	struct OTList {
 		RMGfxPrimitive *_prim;
 		OTList *_next;
+		OTList *_prev;
+		int _nPrior;
+	};
 
-		OTList();
-		OTList(RMGfxPrimitive *pr) {
-			_prim = pr;
-		}
+	/**
+	 * First item of each priority present in the OT list, sorted by priority
+	 */
+	struct OTBucket {
+		int _nPrior;
+		OTList *_first;
 	};
 
 	bool _trackDirtyRects;
@@ -451,9 +457,17 @@ private:
 private:
 	//OSystem::MutexRef csModifyingOT;
 
+	OTList *allocOTItem();
+	void removeOTItem(OTList *item);
+	uint findOTBucket(int nPrior);
+
 protected:
 	OTList *_otlist;
+	OTList *_otLast;
+	OTList *_otFree;                // Recycled OT list items
+	Common::Array<OTBucket> _otBuckets;
 	int _otSize;
+	int _otDrawn;                   // Primitives drawn by the last drawOT call
 
 public:
 	RMGfxTargetBuffer();
@@ -467,6 +481,9 @@ public:
 	void clearOT();
 	void drawOT(CORO_PARAM);
 	void addPrim(RMGfxPrimitive *prim); // The pointer must be delted
+	int getOTSize() const { return _otSize; }
+	int getOTDrawn() const { return _otDrawn; }
+	int getOTPriorities() const { return _otBuckets.size(); }
 
 	operator byte *();
 	operator void *();
@@ -22,6 +22,7 @@
  */
 
 #include "common/algorithm.h"
+#include "common/memorypool.h"
 #include "common/textconsole.h"
 #include "tony/mpal/memory.h"
 
@@ -29,6 +30,26 @@ namespace Tony {
 
 namespace MPAL {
 
+namespace {
+enum {
+	kPoolGranularity = 16,
+	kPoolCount = 16
+};
+
+/**
+ * Pools for the small blocks, by size in steps of kPoolGranularity. Loading
+ * the MPAL data creates thousands of small blocks (strings, expressions,
+ * commands...), which would otherwise each get their own heap allocation.
+ */
+Common::MemoryPool *s_pools[kPoolCount];
+
+uint getPool(uint32 size) {
+	return (sizeof(MemoryItem) + size - 1) / kPoolGranularity;
+}
+} // End of anonymous namespace
+
+MemoryStats MemoryManager::_stats;
+
 /****************************************************************************\
 *       MemoryManager methods
 \****************************************************************************/
@@ -38,7 +59,23 @@ namespace MPAL {
  * @return					Returns a MemoryItem instance for the new block
  */
 MpalHandle MemoryManager::allocate(uint32 size, uint flags) {
-	MemoryItem *newItem = (MemoryItem *)malloc(sizeof(MemoryItem) + size);
+	MemoryItem *newItem;
+	const uint pool = getPool(size);
+
+	if (pool < kPoolCount) {
+		if (!s_pools[pool])
+			s_pools[pool] = new Common::MemoryPool((pool + 1) * kPoolGranularity);
+
+		newItem = (MemoryItem *)s_pools[pool]->allocChunk();
+		++_stats._numPooledBlocks;
+	} else {
+		newItem = (MemoryItem *)malloc(sizeof(MemoryItem) + size);
+	}
+
+	++_stats._numBlocks;
+	_stats._size += size;
+	_stats._peakSize = MAX(_stats._peakSize, _stats._size);
+
 	newItem->_id = BLOCK_ID;
 	newItem->_size = size;
 	newItem->_lockCount = 0;
@@ -89,7 +126,7 @@ uint32 MemoryManager::getSize(MpalHandle handle) {
 void MemoryManager::freeBlock(MpalHandle handle) {
 	MemoryItem *item = (MemoryItem *)handle;
 	assert(item->_id == BLOCK_ID);
-	free(item);
+	freeItem(item);
 }
 
 /**
@@ -98,7 +135,38 @@ void MemoryManager::freeBlock(MpalHandle handle) {
 void MemoryManager::destroyItem(MpalHandle handle) {
 	MemoryItem *item = getItem(handle);
 	assert(item->_id == BLOCK_ID);
-	free(item);
+	freeItem(item);
+}
+
+void MemoryManager::freeItem(MemoryItem *item) {
+	const uint pool = getPool(item->_size);
+
+	--_stats._numBlocks;
+	_stats._size -= item->_size;
+
+	// Clear the id, so that using a freed block triggers the asserts
+	item->_id = 0;
+
+	if (pool < kPoolCount) {
+		assert(s_pools[pool]);
+		s_pools[pool]->freeChunk(item);
+		--_stats._numPooledBlocks;
+	} else {
+		free(item);
+	}
+}
+
+/**
+ * Frees the memory pools, along with any block still allocated from them.
+ * This is done when the engine shuts down, once the MPAL data is gone.
+ */
+void MemoryManager::freePools() {
+	for (int i = 0; i < kPoolCount; ++i) {
+		delete s_pools[i];
+		s_pools[i] = NULL;
+	}
+
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 /**
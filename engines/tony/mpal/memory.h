@@ -43,9 +43,22 @@ struct MemoryItem {
 	operator void *() { return &_data[0]; }
 };
 
+/**
+ * Statistics about the allocated memory blocks
+ */
+struct MemoryStats {
+	uint32 _numBlocks;          ///< Currently allocated blocks
+	uint32 _numPooledBlocks;    ///< Currently allocated blocks served from the pools
+	uint32 _size;               ///< Total size of the allocated blocks
+	uint32 _peakSize;           ///< Maximum total size reached so far
+};
+
 class MemoryManager {
 private:
+	static MemoryStats _stats;
+
 	static MemoryItem *getItem(MpalHandle handle);
+	static void freeItem(MemoryItem *item);
 public:
 	static MpalHandle allocate(uint32 size, uint flags);
 	static void *alloc(uint32 size, uint flags);
@@ -54,6 +67,9 @@ public:
 	static uint32 getSize(MpalHandle handle);
 	static byte *lockItem(MpalHandle handle);
 	static void unlockItem(MpalHandle handle);
+
+	static const MemoryStats &getStats() { return _stats; }
+	static void freePools();
 };
 
 // defines
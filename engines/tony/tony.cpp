@@ -93,6 +93,9 @@ TonyEngine::~TonyEngine() {
 	CoroScheduler.setResourceCallback(NULL);
 
 	delete _debugger;
+
+	// Free what is left of the MPAL data
+	MPAL::MemoryManager::freePools();
 }
 
 /**
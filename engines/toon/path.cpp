@@ -57,7 +57,6 @@ void PathFindingHeap::clear() {
 	debugC(1, kDebugPath, "clear()");
 
 	_count = 0;
-	memset(_data, 0, sizeof(HeapDataGrid) * _size);
 }
 
 void PathFindingHeap::push(int16 x, int16 y, uint16 weight) {
@@ -151,6 +150,8 @@ PathFinding::PathFinding() {
 	_height = 0;
 	_heap = new PathFindingHeap();
 	_sq = NULL;
+	_sqGeneration = NULL;
+	_generation = 0;
 	_numBlockingRects = 0;
 }
 
@@ -159,6 +160,7 @@ PathFinding::~PathFinding(void) {
 		_heap->unload();
 	delete _heap;
 	delete[] _sq;
+	delete[] _sqGeneration;
 }
 
 void PathFinding::init(Picture *mask) {
@@ -171,6 +173,10 @@ void PathFinding::init(Picture *mask) {
 	_heap->init(500);
 	delete[] _sq;
 	_sq = new uint16[_width * _height];
+	delete[] _sqGeneration;
+	_sqGeneration = new uint16[_width * _height];
+	memset(_sqGeneration, 0, _width * _height * sizeof(uint16));
+	_generation = 0;
 }
 
 bool PathFinding::isLikelyWalkable(int16 x, int16 y) {
@@ -304,13 +310,17 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 	}
 
 	// no direct line, we use the standard A* algorithm
-	memset(_sq , 0, _width * _height * sizeof(uint16));
+	if (++_generation == 0) {
+		// The generation wrapped around, so old stamps become valid again
+		memset(_sqGeneration, 0, _width * _height * sizeof(uint16));
+		_generation = 1;
+	}
 	_heap->clear();
 	int16 curX = x;
 	int16 curY = y;
 	uint16 curWeight = 0;
 
-	_sq[curX + curY *_width] = 1;
+	setWeight(curX + curY * _width, 1);
 	_heap->push(curX, curY, abs(destx - x) + abs(desty - y));
 
 	while (_heap->getCount()) {
@@ -330,14 +340,15 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 
 					if (isWalkable(px, py)) { // walkable ?
 						int32 curPNode = px + py * _width;
-						uint32 sum = _sq[curNode] + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
+						uint32 sum = getWeight(curNode) + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
 						if (sum > (uint32)0xFFFF) {
 							warning("PathFinding::findPath sum exceeds maximum representable!");
 							sum = (uint32)0xFFFF;
 						}
-						if (_sq[curPNode] > sum || !_sq[curPNode]) {
-							_sq[curPNode] = sum;
-							uint32 newWeight = _sq[curPNode] + abs(destx - px) + abs(desty - py);
+						uint16 curPWeight = getWeight(curPNode);
+						if (curPWeight > sum || !curPWeight) {
+							setWeight(curPNode, sum);
+							uint32 newWeight = sum + abs(destx - px) + abs(desty - py);
 							if (newWeight > (uint32)0xFFFF) {
 								warning("PathFinding::findPath newWeight exceeds maximum representable!");
 								newWeight = (uint16)0xFFFF;
@@ -353,7 +364,7 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 	}
 
 	// let's see if we found a result !
-	if (!_sq[destx + desty * _width]) {
+	if (!getWeight(destx + desty * _width)) {
 		// didn't find anything
 		_tempPath.clear();
 		return false;
@@ -365,7 +376,7 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 	Common::Array<Common::Point> retPath;
 	retPath.push_back(Common::Point(curX, curY));
 
-	uint16 bestscore = _sq[destx + desty * _width];
+	uint16 bestscore = getWeight(destx + desty * _width);
 
 	bool retVal = false;
 	while (true) {
@@ -380,10 +391,10 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		for (int16 px = startX; px <= endX; px++) {
 			for (int16 py = startY; py <= endY; py++) {
 				if (px != curX || py != curY) {
-					int32 PNode = px + py * _width;
-					if (_sq[PNode] && (isWalkable(px, py))) {
-						if (_sq[PNode] < bestscore) {
-							bestscore = _sq[PNode];
+					uint16 pWeight = getWeight(px + py * _width);
+					if (pWeight && (isWalkable(px, py))) {
+						if (pWeight < bestscore) {
+							bestscore = pWeight;
 							bestX = px;
 							bestY = py;
 						}
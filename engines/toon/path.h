@@ -80,11 +80,18 @@ public:
 private:
 	static const uint8 kMaxBlockingRects = 16;
 
+	// _sq only holds valid weights for the nodes stamped with the current
+	// generation, so it doesn't need to be cleared for every search
+	uint16 getWeight(int32 node) const { return _sqGeneration[node] == _generation ? _sq[node] : 0; }
+	void setWeight(int32 node, uint16 weight) { _sq[node] = weight; _sqGeneration[node] = _generation; }
+
 	Picture *_currentMask;
 
 	PathFindingHeap *_heap;
 
 	uint16 *_sq;
+	uint16 *_sqGeneration;
+	uint16 _generation;
 	int16 _width;
 	int16 _height;
 
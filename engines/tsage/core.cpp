@@ -2888,37 +2888,71 @@ void SceneObjectList::draw() {
 	}
 }
 
+/**
+ * Returns whether the given object area, aligned to 4 pixels horizontally,
+ * covers anything
+ */
+static bool hasIntersectionArea(Rect r) {
+	r.left &= ~3;
+	r.right += 3;
+	r.right &= ~3;
+
+	return r.intersects(r);
+}
+
 void SceneObjectList::checkIntersection(Common::Array<SceneObject *> &ObjList, uint ObjIndex, int PaneNum) {
 	uint32 flagMask = (PaneNum == 0) ? OBJFLAG_PANE_0 : OBJFLAG_PANE_1;
-	SceneObject *obj = (ObjIndex == ObjList.size()) ? NULL : ObjList[ObjIndex];
-	Rect rect1;
+	Common::Array<uint> pending;
 
+	// Get the objects to check the other objects against
+	if (ObjIndex == ObjList.size()) {
+		for (uint idx = 0; idx < ObjList.size(); ++idx) {
+			if (ObjList[idx]->_flags & flagMask)
+				pending.push_back(idx);
+		}
+	} else {
+		pending.push_back(ObjIndex);
+	}
+
+	// The bounds of the other object are compared with themselves, so any
+	// object whose bounds are not empty gets flagged by the first object
+	// checked. Only objects with empty bounds depend on the pane rect of
+	// each flagged object.
+	Common::Array<uint> emptyObjs;
 	for (uint idx = 0; idx < ObjList.size(); ++idx) {
-		SceneObject *currObj = ObjList[idx];
+		if (!(ObjList[idx]->_flags & flagMask) && !hasIntersectionArea(ObjList[idx]->_bounds))
+			emptyObjs.push_back(idx);
+	}
+
+	bool flaggedObjs = false;
+	while (!pending.empty()) {
+		uint objIndex = pending.back();
+		pending.pop_back();
+
+		if (!flaggedObjs) {
+			for (uint idx = 0; idx < ObjList.size(); ++idx) {
+				SceneObject *currObj = ObjList[idx];
+				if (!(currObj->_flags & flagMask) && hasIntersectionArea(currObj->_bounds)) {
+					currObj->_flags |= flagMask;
+					pending.push_back(idx);
+				}
+			}
+			flaggedObjs = true;
+		}
+
+		const Rect &paneRect = ObjList[objIndex]->_paneRects[PaneNum];
+		for (uint i = 0; i < emptyObjs.size(); ++i) {
+			SceneObject *currObj = ObjList[emptyObjs[i]];
+			if (emptyObjs[i] == objIndex || (currObj->_flags & flagMask))
+				continue;
 
-		if (ObjIndex == ObjList.size()) {
-			if (currObj->_flags & flagMask)
-				checkIntersection(ObjList, idx, PaneNum);
-		} else if (idx != ObjIndex) {
-			Rect &paneRect = obj->_paneRects[PaneNum];
 			Rect objBounds = currObj->_bounds;
 			if (paneRect.isValidRect())
 				objBounds.extend(paneRect);
 
-			Rect objBounds2 = currObj->_bounds;
-			if (paneRect.isValidRect())
-				objBounds2.extend(paneRect);
-
-			objBounds.left &= ~3;
-			objBounds.right += 3;
-			objBounds.right &= ~3;
-			objBounds2.left &= ~3;
-			objBounds2.right += 3;
-			objBounds2.right &= ~3;
-
-			if (objBounds.intersects(objBounds2) && !(currObj->_flags & flagMask)) {
+			if (hasIntersectionArea(objBounds)) {
 				currObj->_flags |= flagMask;
-				checkIntersection(ObjList, idx, PaneNum);
+				pending.push_back(emptyObjs[i]);
 			}
 		}
 	}
@@ -653,6 +653,12 @@ void GfxSurface::draw(const Common::Point &pt, Rect *rect) {
 	}
 }
 
+struct RectLeftLess {
+	bool operator()(const Rect &x, const Rect &y) const {
+		return x.left < y.left;
+	}
+};
+
 /**
  * Merges any clipping rectangles that overlap to try and reduce
  * the total number of clip rectangles.
@@ -661,26 +667,67 @@ void GfxSurface::mergeDirtyRects() {
 	if (_dirtyRects.size() <= 1)
 		return;
 
-	Common::List<Rect>::iterator rOuter, rInner;
-
-	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
-
-			if ((*rOuter).intersects(*rInner)) {
-				// these two rectangles overlap or
-				// are next to each other - merge them
+	// Sweep over the rects from left to right. A merged rect which ends left
+	// of the current rect is retired, and only needs to be checked again
+	// when a later merge grows a rect to the left of the sweep position
+	Common::Array<Rect> rects;
+	for (Common::List<Rect>::iterator i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
+		if (!(*i).isEmpty())
+			rects.push_back(*i);
+	}
+	Common::sort(rects.begin(), rects.end(), RectLeftLess());
 
-				unionRectangle(*rOuter, *rOuter, *rInner);
+	_dirtyRects.clear();
+	Common::Array<Rect> active;
+	Common::Array<Rect> retired;
+
+	for (uint idx = 0; idx < rects.size(); ++idx) {
+		Rect r = rects[idx];
+		const int16 sweepLeft = r.left;
+
+		for (uint i = 0; i < active.size(); ) {
+			if (active[i].right <= sweepLeft) {
+				retired.push_back(active[i]);
+				active.remove_at(i);
+			} else {
+				++i;
+			}
+		}
 
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
+		// Merge the rect with any overlapping rect. Since the merged rect
+		// grows, check all the active rects again after each merge
+		bool merged;
+		do {
+			merged = false;
+			for (uint i = 0; i < active.size(); ++i) {
+				if (r.intersects(active[i])) {
+					unionRectangle(r, r, active[i]);
+					active.remove_at(i);
+					merged = true;
+					break;
+				}
+			}
 
-				// move back to beginning of list
-				rInner = rOuter;
+			// Retired rects all end left of the sweep position
+			if (!merged && r.left < sweepLeft) {
+				for (uint i = 0; i < retired.size(); ++i) {
+					if (r.intersects(retired[i])) {
+						unionRectangle(r, r, retired[i]);
+						retired.remove_at(i);
+						merged = true;
+						break;
+					}
+				}
 			}
-		}
+		} while (merged);
+
+		active.push_back(r);
 	}
+
+	for (uint i = 0; i < retired.size(); ++i)
+		_dirtyRects.push_back(retired[i]);
+	for (uint i = 0; i < active.size(); ++i)
+		_dirtyRects.push_back(active[i]);
 }
 
 /**
@@ -62,7 +62,13 @@ void doBlitOpaque(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pit
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		memcpy(out, in, width * 4);
+		if (inStep == 4) {
+			memcpy(out, in, width * 4);
+		} else {
+			// Mirrored, copy the pixels one by one
+			for (uint32 j = 0; j < width; j++)
+				*(uint32 *)(out + j * 4) = *(uint32 *)(in + (int32)j * inStep);
+		}
 		for (uint32 j = 0; j < width; j++) {
 			out[aIndex] = 0xFF;
 			out += 4;
@@ -112,49 +118,60 @@ void TransparentSurface::doBlitAlpha(byte *ino, byte* outo, uint32 width, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		for (uint32 j = 0; j < width; j++) {
+		for (uint32 j = 0; j < width; ) {
 			uint32 pix = *(uint32 *)in;
+			int a = (pix >> aShift) & 0xff;
+
+			if (a == 0) {
+				// Full transparency
+				in += inStep;
+				out += 4;
+				j++;
+				continue;
+			}
+
+			if (a == 255) {
+				// Full opacity, copy the whole run of opaque pixels at once
+				int32 run = 1;
+				while (j + run < width && (*(uint32 *)(in + run * inStep) >> aShift) == 0xff)
+					run++;
+
+				if (inStep == 4) {
+					memcpy(out, in, run * 4);
+				} else {
+					for (int32 k = 0; k < run; k++)
+						*(uint32 *)(out + k * 4) = *(uint32 *)(in + k * inStep);
+				}
+
+				in += run * inStep;
+				out += run * 4;
+				j += run;
+				continue;
+			}
+
+			// Alpha blending
 			uint32 oPix = *(uint32 *) out;
 			int b = (pix >> bShift) & 0xff;
 			int g = (pix >> gShift) & 0xff;
 			int r = (pix >> rShift) & 0xff;
-			int a = (pix >> aShift) & 0xff;
 			int outb, outg, outr, outa;
-			in += inStep;
 
-			switch (a) {
-				case 0: // Full transparency
-					out += 4;
-					break;
-				case 255: // Full opacity
-					outb = b;
-					outg = g;
-					outr = r;
-					outa = a;
-
-					out[aIndex] = outa;
-					out[bIndex] = outb;
-					out[gIndex] = outg;
-					out[rIndex] = outr;
-					out += 4;
-					break;
-
-				default: // alpha blending
-					outa = 255;
-
-					outb = _lookup[(((oPix >> bShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outg = _lookup[(((oPix >> gShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outr = _lookup[(((oPix >> rShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outb += _lookup[b + (a << 8)];
-					outg += _lookup[g + (a << 8)];
-					outr += _lookup[r + (a << 8)];
-
-					out[aIndex] = outa;
-					out[bIndex] = outb;
-					out[gIndex] = outg;
-					out[rIndex] = outr;
-					out += 4;
-			}
+			outa = 255;
+
+			outb = _lookup[(((oPix >> bShiftTarget) & 0xff)) + ((255 - a) << 8)];
+			outg = _lookup[(((oPix >> gShiftTarget) & 0xff)) + ((255 - a) << 8)];
+			outr = _lookup[(((oPix >> rShiftTarget) & 0xff)) + ((255 - a) << 8)];
+			outb += _lookup[b + (a << 8)];
+			outg += _lookup[g + (a << 8)];
+			outr += _lookup[r + (a << 8)];
+
+			out[aIndex] = outa;
+			out[bIndex] = outb;
+			out[gIndex] = outg;
+			out[rIndex] = outr;
+			in += inStep;
+			out += 4;
+			j++;
 		}
 		outo += pitch;
 		ino += inoStep;
@@ -403,13 +420,20 @@ TransparentSurface *TransparentSurface::scale(const Common::Rect &srcRect, const
 
 	target->create((uint16)dstW, (uint16)dstH, this->format);
 
+	// Compute the source column of each destination column once, instead
+	// of dividing for each pixel
+	int *srcX = new int[dstW];
+	for (int x = 0; x < dstW; x++)
+		srcX[x] = x * srcW / dstW + srcRect.left;
+
 	for (int y = 0; y < dstH; y++) {
-		for (int x = 0; x < dstW; x++) {
-			uint32 color = READ_UINT32((const byte *)getBasePtr(x * srcW / dstW + srcRect.left,
-														  y * srcH / dstH + srcRect.top));
-			WRITE_UINT32((byte *)target->getBasePtr(x + dstRect.left, y + dstRect.top), color);
-		}
+		const uint32 *src = (const uint32 *)getBasePtr(0, y * srcH / dstH + srcRect.top);
+		uint32 *dst = (uint32 *)target->getBasePtr(dstRect.left, y + dstRect.top);
+		for (int x = 0; x < dstW; x++)
+			dst[x] = src[srcX[x]];
 	}
+
+	delete[] srcX;
 	return target;
 
 }
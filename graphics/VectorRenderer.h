@@ -266,6 +266,32 @@ public:
 		_activeSurface = surface;
 	}
 
+	/**
+	 * Returns the surface currently being drawn on.
+	 */
+	Surface *getActiveSurface() const {
+		return _activeSurface;
+	}
+
+	/**
+	 * Colors currently set on the renderer, in the format of the
+	 * drawing surface. Drawing steps which don't specify some of their
+	 * colors draw with the ones left over from previous steps.
+	 */
+	struct ColorState {
+		uint32 fg, bg, bevel, gradientStart, gradientEnd;
+	};
+
+	/**
+	 * Returns the colors currently set on the renderer.
+	 */
+	virtual ColorState getColorState() const = 0;
+
+	/**
+	 * Returns whether shadows are temporarily disabled.
+	 */
+	bool shadowsDisabled() const { return _disableShadows; }
+
 	/**
 	 * Fills the active surface with the specified fg/bg color or the active gradient.
 	 * Defaults to using the active Foreground color for filling.
@@ -418,6 +444,15 @@ public:
 	 */
 	virtual void drawStep(const Common::Rect &area, const DrawStep &step, uint32 extra = 0);
 
+	/**
+	 * Sets up the colors and drawing parameters of the specified draw step,
+	 * exactly as drawStep() does, but without drawing anything.
+	 *
+	 * @see DrawStep
+	 * @param step Pointer to a DrawStep struct.
+	 */
+	void applyStepState(const DrawStep &step, uint32 extra = 0);
+
 	/**
 	 * Copies the part of the current frame to the system overlay.
 	 *
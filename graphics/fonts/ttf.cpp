@@ -122,15 +122,47 @@ private:
 	int _width, _height;
 	int _ascent, _descent;
 
+	enum GlyphState {
+		kGlyphNotLoaded = 0,
+		kGlyphLoaded,
+		kGlyphMissing
+	};
+
 	struct Glyph {
-		Surface image;
+		GlyphState state;
+		// Position of the glyph image inside its atlas page
+		uint page;
+		int x, y, w, h;
 		int xOffset, yOffset;
 		int advance;
 	};
 
-	bool cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr);
-	typedef Common::HashMap<byte, Glyph> GlyphCache;
-	GlyphCache _glyphs;
+	/**
+	 * Returns the glyph of the given character, rendering it on first use.
+	 * Returns 0 in case the font has no glyph for the character.
+	 */
+	const Glyph *getGlyph(byte chr) const;
+	bool cacheGlyph(Glyph &glyph, FT_UInt slot) const;
+
+	// Glyphs are rendered lazily, so these are filled in by const methods.
+	mutable Glyph _glyphs[256];
+
+	/**
+	 * Glyph images are packed into shared 8bpp atlas surfaces, row by row,
+	 * instead of each glyph having a surface of its own.
+	 */
+	mutable Common::Array<Surface *> _atlasPages;
+	mutable int _atlasX, _atlasY, _atlasRowHeight;
+	bool allocateAtlasRect(int w, int h, Glyph &glyph) const;
+
+	/**
+	 * Kerning offsets of all character pairs, queried from FreeType on
+	 * first use. kKerningUnknown marks pairs not queried yet.
+	 */
+	enum {
+		kKerningUnknown = -128
+	};
+	mutable int8 *_kerning;
 
 	FT_UInt _glyphSlots[256];
 
@@ -140,7 +172,8 @@ private:
 
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
-      _descent(0), _glyphs(), _glyphSlots(), _monochrome(false), _hasKerning(false) {
+      _descent(0), _glyphs(), _atlasPages(), _atlasX(0), _atlasY(0), _atlasRowHeight(0),
+      _kerning(0), _glyphSlots(), _monochrome(false), _hasKerning(false) {
 }
 
 TTFFont::~TTFFont() {
@@ -150,8 +183,14 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
+		for (uint i = 0; i < _atlasPages.size(); ++i) {
+			_atlasPages[i]->free();
+			delete _atlasPages[i];
+		}
+		_atlasPages.clear();
+
+		delete[] _kerning;
+		_kerning = 0;
 
 		_initialized = false;
 	}
@@ -211,27 +250,32 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, uint dpi, bool
 	_width = ftCeil26_6(FT_MulFix(_face->max_advance_width, _face->size->metrics.x_scale));
 	_height = _ascent - _descent + 1;
 
-	if (!mapping) {
-		// Load all ISO-8859-1 characters.
-		for (uint i = 0; i < 256; ++i) {
-			if (!cacheGlyph(_glyphs[i], _glyphSlots[i], i))
-				_glyphSlots[i] = 0;
-		}
-	} else {
-		for (uint i = 0; i < 256; ++i) {
-			const uint32 unicode = mapping[i] & 0x7FFFFFFF;
-			const bool isRequired = (mapping[i] & 0x80000000) != 0;
-			// Check whether loading an important glyph fails and error out if
+	// Only look up the glyph indices here. The glyphs themselves are
+	// rendered when they are used for the first time.
+	bool hasGlyphs = false;
+	for (uint i = 0; i < 256; ++i) {
+		// Without a mapping we load all ISO-8859-1 characters.
+		const uint32 unicode = mapping ? (mapping[i] & 0x7FFFFFFF) : i;
+		const bool isRequired = mapping && (mapping[i] & 0x80000000) != 0;
+
+		_glyphSlots[i] = FT_Get_Char_Index(_face, unicode);
+		_glyphs[i].state = _glyphSlots[i] ? kGlyphNotLoaded : kGlyphMissing;
+
+		if (_glyphSlots[i]) {
+			hasGlyphs = true;
+		} else if (isRequired) {
+			// Check whether an important glyph is missing and error out if
 			// that is the case.
-			if (!cacheGlyph(_glyphs[i], _glyphSlots[i], unicode)) {
-				_glyphSlots[i] = 0;
-				if (isRequired)
-					return false;
-			}
+			delete[] _ttfFile;
+			_ttfFile = 0;
+
+			g_ttf.closeFont(_face);
+
+			return false;
 		}
 	}
 
-	_initialized = (_glyphs.size() != 0);
+	_initialized = hasGlyphs;
 	return _initialized;
 }
 
@@ -244,26 +288,84 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(byte chr) const {
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyph = getGlyph(chr);
+	if (!glyph)
 		return 0;
 	else
-		return glyphEntry->_value.advance;
+		return glyph->advance;
 }
 
 int TTFFont::getKerningOffset(byte left, byte right) const {
 	if (!_hasKerning)
 		return 0;
 
+	if (_kerning) {
+		const int8 offset = _kerning[left * 256 + right];
+		if (offset != kKerningUnknown)
+			return offset;
+	} else {
+		_kerning = new int8[256 * 256];
+		memset(_kerning, kKerningUnknown, 256 * 256);
+	}
+
 	FT_UInt leftGlyph = _glyphSlots[left];
 	FT_UInt rightGlyph = _glyphSlots[right];
 
-	if (!leftGlyph || !rightGlyph)
-		return 0;
+	int offset = 0;
+	if (leftGlyph && rightGlyph) {
+		FT_Vector kerningVector;
+		FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+		offset = (kerningVector.x / 64);
+	}
+
+	// Offsets which do not fit are simply queried again the next time.
+	if (offset > kKerningUnknown && offset <= 127)
+		_kerning[left * 256 + right] = offset;
+
+	return offset;
+}
+
+const TTFFont::Glyph *TTFFont::getGlyph(byte chr) const {
+	Glyph &glyph = _glyphs[chr];
+
+	if (glyph.state == kGlyphNotLoaded)
+		glyph.state = cacheGlyph(glyph, _glyphSlots[chr]) ? kGlyphLoaded : kGlyphMissing;
+
+	return (glyph.state == kGlyphLoaded) ? &glyph : 0;
+}
+
+bool TTFFont::allocateAtlasRect(int w, int h, Glyph &glyph) const {
+	// Pages are large enough for a good number of glyphs of this font.
+	const int pageSize = MAX<int>(256, MAX(_width, _height) * 8);
+
+	if (w > pageSize || h > pageSize)
+		return false;
+
+	if (!_atlasPages.empty() && _atlasX + w > _atlasPages.back()->w) {
+		// Start a new row
+		_atlasX = 0;
+		_atlasY += _atlasRowHeight;
+		_atlasRowHeight = 0;
+	}
+
+	if (_atlasPages.empty() || _atlasY + h > _atlasPages.back()->h) {
+		Surface *page = new Surface();
+		page->create(pageSize, pageSize, PixelFormat::createFormatCLUT8());
+		memset(page->getBasePtr(0, 0), 0, page->h * page->pitch);
+		_atlasPages.push_back(page);
+
+		_atlasX = _atlasY = _atlasRowHeight = 0;
+	}
 
-	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	glyph.page = _atlasPages.size() - 1;
+	glyph.x = _atlasX;
+	glyph.y = _atlasY;
+	glyph.w = w;
+	glyph.h = h;
+
+	_atlasX += w;
+	_atlasRowHeight = MAX(_atlasRowHeight, h);
+	return true;
 }
 
 namespace {
@@ -305,11 +407,11 @@ void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const i
 } // End of anonymous namespace
 
 void TTFFont::drawChar(Surface *dst, byte chr, int x, int y, uint32 color) const {
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyphPtr = getGlyph(chr);
+	if (!glyphPtr)
 		return;
 
-	const Glyph &glyph = glyphEntry->_value;
+	const Glyph &glyph = *glyphPtr;
 
 	x += glyph.xOffset;
 	y += glyph.yOffset;
@@ -319,10 +421,11 @@ void TTFFont::drawChar(Surface *dst, byte chr, int x, int y, uint32 color) const
 	if (y > dst->h)
 		return;
 
-	int w = glyph.image.w;
-	int h = glyph.image.h;
+	int w = glyph.w;
+	int h = glyph.h;
 
-	const uint8 *srcPos = (const uint8 *)glyph.image.getBasePtr(0, 0);
+	const Surface &image = *_atlasPages[glyph.page];
+	const uint8 *srcPos = (const uint8 *)image.getBasePtr(glyph.x, glyph.y);
 
 	// Make sure we are not drawing outside the screen bounds
 	if (x < 0) {
@@ -338,7 +441,7 @@ void TTFFont::drawChar(Surface *dst, byte chr, int x, int y, uint32 color) const
 		return;
 
 	if (y < 0) {
-		srcPos -= y * glyph.image.pitch;
+		srcPos -= y * image.pitch;
 		h += y;
 		y = 0;
 	}
@@ -367,17 +470,16 @@ void TTFFont::drawChar(Surface *dst, byte chr, int x, int y, uint32 color) const
 			}
 
 			dstPos += dst->pitch;
-			srcPos += glyph.image.pitch;
+			srcPos += image.pitch;
 		}
 	} else if (dst->format.bytesPerPixel == 2) {
-		renderGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+		renderGlyph<uint16>(dstPos, dst->pitch, srcPos, image.pitch, w, h, color, dst->format);
 	} else if (dst->format.bytesPerPixel == 4) {
-		renderGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+		renderGlyph<uint32>(dstPos, dst->pitch, srcPos, image.pitch, w, h, color, dst->format);
 	}
 }
 
-bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr) {
-	slot = FT_Get_Char_Index(_face, chr);
+bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt slot) const {
 	if (!slot)
 		return false;
 
@@ -413,7 +515,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr) {
 	}
 
 	const FT_Bitmap &bitmap = _face->glyph->bitmap;
-	glyph.image.create(bitmap.width, bitmap.rows, PixelFormat::createFormatCLUT8());
+	if (!allocateAtlasRect(bitmap.width, bitmap.rows, glyph)) {
+		warning("TTFFont::cacheGlyph: Glyph of size %dx%d too large", bitmap.width, bitmap.rows);
+		return false;
+	}
+
+	Surface &image = *_atlasPages[glyph.page];
 
 	const uint8 *src = bitmap.buffer;
 	int srcPitch = bitmap.pitch;
@@ -422,8 +529,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr) {
 		srcPitch = -srcPitch;
 	}
 
-	uint8 *dst = (uint8 *)glyph.image.getBasePtr(0, 0);
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
+	uint8 *dst = (uint8 *)image.getBasePtr(glyph.x, glyph.y);
 
 	switch (bitmap.pixel_mode) {
 	case FT_PIXEL_MODE_MONO:
@@ -442,6 +548,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr) {
 				++dst;
 			}
 
+			dst += image.pitch - bitmap.width;
 			src += srcPitch;
 		}
 		break;
@@ -449,7 +556,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, FT_UInt &slot, uint chr) {
 	case FT_PIXEL_MODE_GRAY:
 		for (int y = 0; y < bitmap.rows; ++y) {
 			memcpy(dst, src, bitmap.width);
-			dst += glyph.image.pitch;
+			dst += image.pitch;
 			src += srcPitch;
 		}
 		break;
@@ -16,6 +16,7 @@ MODULE_OBJS := \
 	scaler.o \
 	scaler/thumbnail_intern.o \
 	sjis.o \
+	spritecache.o \
 	surface.o \
 	thumbnail.o \
 	VectorRenderer.o \
@@ -0,0 +1,177 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+#include "common/endian.h"
+#include "common/util.h"
+#include "graphics/spritecache.h"
+
+namespace Graphics {
+
+CachedSprite::CachedSprite(const Surface &surface, uint32 transparentColor) {
+	const uint bpp = surface.format.bytesPerPixel;
+	assert(bpp == 1 || bpp == 2 || bpp == 4);
+
+	_surface.copyFrom(surface);
+
+	_rows.reserve(_surface.h + 1);
+	for (uint16 y = 0; y < _surface.h; y++) {
+		_rows.push_back(_spans.size());
+
+		const byte *src = (const byte *)_surface.getBasePtr(0, y);
+		uint16 x = 0;
+		while (x < _surface.w) {
+			// Skip the transparent pixels, then find the end of the run
+			// of opaque pixels
+			bool opaque = false;
+			uint16 start = x;
+			for (; x < _surface.w; x++) {
+				uint32 color;
+				if (bpp == 1)
+					color = src[x];
+				else if (bpp == 2)
+					color = READ_UINT16(src + x * 2);
+				else
+					color = READ_UINT32(src + x * 4);
+
+				if ((color != transparentColor) != opaque) {
+					if (opaque)
+						break;
+					opaque = true;
+					start = x;
+				}
+			}
+
+			if (opaque) {
+				Span span;
+				span.x = start;
+				span.length = x - start;
+				_spans.push_back(span);
+			}
+		}
+	}
+	_rows.push_back(_spans.size());
+}
+
+CachedSprite::~CachedSprite() {
+	_surface.free();
+}
+
+void CachedSprite::blit(Surface &dst, int x, int y) const {
+	const uint bpp = _surface.format.bytesPerPixel;
+	assert(dst.format.bytesPerPixel == bpp);
+
+	const int top = MAX(0, -y);
+	const int bottom = MIN<int>(_surface.h, dst.h - y);
+	const int clipLeft = -x;
+	const int clipRight = dst.w - x;
+
+	for (int row = top; row < bottom; row++) {
+		for (uint32 i = _rows[row]; i < _rows[row + 1]; i++) {
+			int left = MAX<int>(_spans[i].x, clipLeft);
+			int right = MIN<int>(_spans[i].x + _spans[i].length, clipRight);
+			if (left >= right)
+				continue;
+
+			memcpy(dst.getBasePtr(x + left, y + row), _surface.getBasePtr(left, row), (right - left) * bpp);
+		}
+	}
+}
+
+uint32 CachedSprite::getSize() const {
+	return _surface.h * _surface.pitch + _spans.size() * sizeof(Span) + _rows.size() * sizeof(uint32) + sizeof(CachedSprite);
+}
+
+SpriteCache::SpriteCache(uint32 maxSize) : _size(0), _maxSize(maxSize), _useCounter(0) {
+}
+
+SpriteCache::~SpriteCache() {
+	clear();
+}
+
+const CachedSprite *SpriteCache::find(uint32 resource, uint32 frame) {
+	EntryMap::iterator i = _entries.find(SpriteId(resource, frame));
+	if (i == _entries.end())
+		return 0;
+
+	i->_value.lastUse = ++_useCounter;
+	return i->_value.sprite;
+}
+
+const CachedSprite *SpriteCache::add(uint32 resource, uint32 frame, const Surface &surface, uint32 transparentColor) {
+	const SpriteId id(resource, frame);
+	EntryMap::iterator i = _entries.find(id);
+	if (i != _entries.end())
+		removeEntry(i);
+
+	Entry entry;
+	entry.sprite = new CachedSprite(surface, transparentColor);
+	entry.lastUse = ++_useCounter;
+
+	// A sprite larger than the whole budget still gets added, so that the
+	// returned pointer stays valid, but it is the first one to go
+	const uint32 size = entry.sprite->getSize();
+	evict(size);
+
+	_entries[id] = entry;
+	_size += size;
+
+	return entry.sprite;
+}
+
+void SpriteCache::remove(uint32 resource, uint32 frame) {
+	EntryMap::iterator i = _entries.find(SpriteId(resource, frame));
+	if (i != _entries.end())
+		removeEntry(i);
+}
+
+void SpriteCache::clear() {
+	while (!_entries.empty())
+		removeEntry(_entries.begin());
+
+	assert(_size == 0);
+	_useCounter = 0;
+}
+
+void SpriteCache::setMaxSize(uint32 maxSize) {
+	_maxSize = maxSize;
+	evict(0);
+}
+
+void SpriteCache::removeEntry(EntryMap::iterator i) {
+	_size -= i->_value.sprite->getSize();
+	delete i->_value.sprite;
+	_entries.erase(i);
+}
+
+void SpriteCache::evict(uint32 size) {
+	while (!_entries.empty() && _size + size > _maxSize) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+
+		removeEntry(oldest);
+	}
+}
+
+} // End of namespace Graphics
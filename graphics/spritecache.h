@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GRAPHICS_SPRITECACHE_H
+#define GRAPHICS_SPRITECACHE_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+
+#include "graphics/surface.h"
+
+namespace Graphics {
+
+/**
+ * A decoded sprite frame, along with the runs of opaque pixels of each of
+ * its rows. Drawing it only copies these runs, so transparent pixels don't
+ * cost anything.
+ */
+class CachedSprite {
+public:
+	/**
+	 * Creates a copy of the given surface. Pixels of the given color are
+	 * considered transparent.
+	 */
+	CachedSprite(const Surface &surface, uint32 transparentColor);
+	~CachedSprite();
+
+	const Surface &getSurface() const { return _surface; }
+
+	/**
+	 * Draws the sprite on the given surface, which needs to have the same
+	 * number of bytes per pixel. The sprite is clipped to the surface.
+	 */
+	void blit(Surface &dst, int x, int y) const;
+
+	/** Returns the memory used by the sprite. */
+	uint32 getSize() const;
+
+private:
+	struct Span {
+		uint16 x;
+		uint16 length;
+	};
+
+	Surface _surface;
+	Common::Array<Span> _spans;
+	Common::Array<uint32> _rows;    ///< Index of the first span of each row, plus the span count
+};
+
+/**
+ * Cache of decoded sprite frames, for engines which otherwise need to decode
+ * their compressed sprites again each time they are drawn.
+ *
+ * Sprites are identified by a resource id and a frame number chosen by the
+ * engine. The frame number can also be used for other variants of the same
+ * resource, like a palette or a mirrored version. Once the total size of the
+ * cached sprites exceeds the budget, they are evicted in least recently used
+ * order.
+ */
+class SpriteCache {
+public:
+	SpriteCache(uint32 maxSize);
+	~SpriteCache();
+
+	/**
+	 * Returns the sprite with the given id, or 0 if it isn't cached. The
+	 * sprite stays valid until the next call to add(), remove(), clear()
+	 * or setMaxSize().
+	 */
+	const CachedSprite *find(uint32 resource, uint32 frame);
+
+	/**
+	 * Adds a copy of the given surface to the cache, replacing any sprite
+	 * with the same id, and returns it. The returned sprite has the same
+	 * lifetime as the ones returned by find().
+	 */
+	const CachedSprite *add(uint32 resource, uint32 frame, const Surface &surface, uint32 transparentColor);
+
+	void remove(uint32 resource, uint32 frame);
+	void clear();
+
+	/** Returns the memory used by the cached sprites. */
+	uint32 getSize() const { return _size; }
+
+	uint32 getMaxSize() const { return _maxSize; }
+	void setMaxSize(uint32 maxSize);
+
+private:
+	struct Entry {
+		CachedSprite *sprite;
+		uint32 lastUse;
+	};
+
+	struct SpriteId {
+		uint32 resource;
+		uint32 frame;
+
+		SpriteId(uint32 r, uint32 f) : resource(r), frame(f) {}
+		bool operator==(const SpriteId &id) const { return resource == id.resource && frame == id.frame; }
+	};
+
+	struct SpriteIdHash {
+		uint operator()(const SpriteId &id) const { return id.resource * 31 + id.frame; }
+	};
+
+	typedef Common::HashMap<SpriteId, Entry, SpriteIdHash> EntryMap;
+
+	void removeEntry(EntryMap::iterator i);
+	void evict(uint32 size);
+
+	EntryMap _entries;
+	uint32 _size;
+	uint32 _maxSize;
+	uint32 _useCounter;
+};
+
+} // End of namespace Graphics
+
+#endif
@@ -205,6 +205,136 @@ void Surface::frameRect(const Common::Rect &r, uint32 color) {
 	vLine(r.right - 1, r.top, r.bottom - 1, color);
 }
 
+/**
+ * Clips a blit from the given area of the source surface to this surface.
+ * Returns false if nothing is left to copy.
+ */
+bool Surface::clipBlit(const Surface &src, Common::Rect &srcRect, int &destX, int &destY, bool flipped) const {
+	srcRect.clip(src.w, src.h);
+	if (!srcRect.isValidRect() || srcRect.isEmpty())
+		return false;
+
+	const int cutLeft = MAX(0, -destX);
+	const int cutTop = MAX(0, -destY);
+	const int cutRight = MAX(0, destX + srcRect.width() - w);
+	const int cutBottom = MAX(0, destY + srcRect.height() - h);
+
+	if (cutLeft + cutRight >= srcRect.width() || cutTop + cutBottom >= srcRect.height())
+		return false;
+
+	// When mirrored, the left edge of the destination comes from the right
+	// edge of the source
+	if (flipped) {
+		srcRect.left += cutRight;
+		srcRect.right -= cutLeft;
+	} else {
+		srcRect.left += cutLeft;
+		srcRect.right -= cutRight;
+	}
+	srcRect.top += cutTop;
+	srcRect.bottom -= cutBottom;
+
+	destX += cutLeft;
+	destY += cutTop;
+	return true;
+}
+
+template<typename T>
+static void transBlitRows(byte *dst, int dstPitch, const byte *src, int srcPitch, int width, int height, uint32 transColor, bool flipped) {
+	const T key = (T)transColor;
+
+	while (height--) {
+		T *d = (T *)dst;
+		if (flipped) {
+			const T *s = (const T *)src + width - 1;
+			for (int x = 0; x < width; x++, s--) {
+				if (*s != key)
+					d[x] = *s;
+			}
+		} else {
+			const T *s = (const T *)src;
+			for (int x = 0; x < width; x++) {
+				if (s[x] != key)
+					d[x] = s[x];
+			}
+		}
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+template<typename T>
+static void maskBlitRows(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *mask, int maskPitch, int width, int height, bool flipped) {
+	while (height--) {
+		T *d = (T *)dst;
+		if (flipped) {
+			const T *s = (const T *)src + width - 1;
+			const byte *m = mask + width - 1;
+			for (int x = 0; x < width; x++, s--, m--) {
+				if (*m)
+					d[x] = *s;
+			}
+		} else {
+			const T *s = (const T *)src;
+			for (int x = 0; x < width; x++) {
+				if (mask[x])
+					d[x] = s[x];
+			}
+		}
+
+		dst += dstPitch;
+		src += srcPitch;
+		mask += maskPitch;
+	}
+}
+
+void Surface::transBlitFrom(const Surface &src, const Common::Rect &srcRect, int destX, int destY, uint32 transColor, bool flipped) {
+	assert(src.format.bytesPerPixel == format.bytesPerPixel);
+
+	Common::Rect r = srcRect;
+	if (!clipBlit(src, r, destX, destY, flipped))
+		return;
+
+	byte *dst = (byte *)getBasePtr(destX, destY);
+	const byte *srcP = (const byte *)src.getBasePtr(r.left, r.top);
+
+	if (format.bytesPerPixel == 1)
+		transBlitRows<uint8>(dst, pitch, srcP, src.pitch, r.width(), r.height(), transColor, flipped);
+	else if (format.bytesPerPixel == 2)
+		transBlitRows<uint16>(dst, pitch, srcP, src.pitch, r.width(), r.height(), transColor, flipped);
+	else if (format.bytesPerPixel == 4)
+		transBlitRows<uint32>(dst, pitch, srcP, src.pitch, r.width(), r.height(), transColor, flipped);
+	else
+		error("Surface::transBlitFrom: bytesPerPixel must be 1, 2, or 4");
+}
+
+void Surface::transBlitFrom(const Surface &src, int destX, int destY, uint32 transColor, bool flipped) {
+	transBlitFrom(src, Common::Rect(src.w, src.h), destX, destY, transColor, flipped);
+}
+
+void Surface::maskBlitFrom(const Surface &src, const Surface &mask, int destX, int destY, bool flipped) {
+	assert(src.format.bytesPerPixel == format.bytesPerPixel);
+	assert(mask.format.bytesPerPixel == 1 && mask.w == src.w && mask.h == src.h);
+
+	Common::Rect r(src.w, src.h);
+	if (!clipBlit(src, r, destX, destY, flipped))
+		return;
+
+	byte *dst = (byte *)getBasePtr(destX, destY);
+	const byte *srcP = (const byte *)src.getBasePtr(r.left, r.top);
+	const byte *maskP = (const byte *)mask.getBasePtr(r.left, r.top);
+
+	if (format.bytesPerPixel == 1)
+		maskBlitRows<uint8>(dst, pitch, srcP, src.pitch, maskP, mask.pitch, r.width(), r.height(), flipped);
+	else if (format.bytesPerPixel == 2)
+		maskBlitRows<uint16>(dst, pitch, srcP, src.pitch, maskP, mask.pitch, r.width(), r.height(), flipped);
+	else if (format.bytesPerPixel == 4)
+		maskBlitRows<uint32>(dst, pitch, srcP, src.pitch, maskP, mask.pitch, r.width(), r.height(), flipped);
+	else
+		error("Surface::maskBlitFrom: bytesPerPixel must be 1, 2, or 4");
+}
+
 void Surface::move(int dx, int dy, int height) {
 	// Short circuit check - do we have to do anything anyway?
 	if ((dx == 0 && dy == 0) || height <= 0)
@@ -224,8 +224,45 @@ struct Surface {
 	 */
 	void frameRect(const Common::Rect &r, uint32 color);
 
+	/**
+	 * Copy an area of another surface to this surface, skipping the pixels
+	 * of the given transparent color. The area is clipped to this surface.
+	 *
+	 * @param src The surface to copy from. It must have the same number
+	 *            of bytes per pixel as this surface.
+	 * @param srcRect The area of the source surface to copy.
+	 * @param destX The x coordinate where to copy the area to.
+	 * @param destY The y coordinate where to copy the area to.
+	 * @param transColor The transparent color.
+	 * @param flipped Whether the area is mirrored horizontally.
+	 */
+	void transBlitFrom(const Surface &src, const Common::Rect &srcRect, int destX, int destY, uint32 transColor, bool flipped = false);
+
+	/**
+	 * Copy another surface to this surface, skipping the pixels of the given
+	 * transparent color. See above for the parameters.
+	 */
+	void transBlitFrom(const Surface &src, int destX, int destY, uint32 transColor, bool flipped = false);
+
+	/**
+	 * Copy another surface to this surface, skipping the pixels for which
+	 * the given mask is 0. The surface is clipped to this surface.
+	 *
+	 * @param src The surface to copy from. It must have the same number
+	 *            of bytes per pixel as this surface.
+	 * @param mask A surface of the same size as the source surface, with
+	 *             1 byte per pixel.
+	 * @param destX The x coordinate where to copy the surface to.
+	 * @param destY The y coordinate where to copy the surface to.
+	 * @param flipped Whether the surface is mirrored horizontally.
+	 */
+	void maskBlitFrom(const Surface &src, const Surface &mask, int destX, int destY, bool flipped = false);
+
 	// See comment in graphics/surface.cpp about it
 	void move(int dx, int dy, int height);
+
+private:
+	bool clipBlit(const Surface &src, Common::Rect &srcRect, int &destX, int &destY, bool flipped) const;
 };
 
 /**
@@ -0,0 +1,162 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "gui/ThemeDrawCache.h"
+
+namespace GUI {
+
+ThemeDrawCache::ThemeDrawCache(uint32 maxSize) : _lruHead(0), _lruTail(0), _size(0), _maxSize(maxSize) {
+}
+
+ThemeDrawCache::~ThemeDrawCache() {
+	clear();
+}
+
+bool ThemeDrawCache::restore(const Key &key, Graphics::Surface *surface, const Common::Rect &r) {
+	EntryMap::iterator i = _entries.find(key);
+	if (i == _entries.end())
+		return false;
+
+	Entry *entry = i->_value;
+	const uint rowSize = r.width() * surface->format.bytesPerPixel;
+
+	for (int y = 0; y < r.height(); ++y) {
+		if (memcmp(surface->getBasePtr(r.left, r.top + y), entry->background->getBasePtr(0, y), rowSize))
+			return false;
+	}
+
+	for (int y = 0; y < r.height(); ++y)
+		memcpy(surface->getBasePtr(r.left, r.top + y), entry->drawing.getBasePtr(0, y), rowSize);
+
+	if (entry != _lruHead) {
+		unlinkEntry(entry);
+		linkEntry(entry);
+	}
+	return true;
+}
+
+void ThemeDrawCache::store(const Key &key, Graphics::Surface *background, const Graphics::Surface *surface, const Common::Rect &r) {
+	EntryMap::iterator i = _entries.find(key);
+	if (i != _entries.end())
+		removeEntry(i->_value);
+
+	Entry *entry = new Entry;
+	entry->key = key;
+	entry->background = background;
+	entry->drawing.create(r.width(), r.height(), surface->format);
+
+	const uint rowSize = r.width() * surface->format.bytesPerPixel;
+	for (int y = 0; y < r.height(); ++y)
+		memcpy(entry->drawing.getBasePtr(0, y), surface->getBasePtr(r.left, r.top + y), rowSize);
+
+	evict(entrySize(entry));
+
+	_entries[key] = entry;
+	linkEntry(entry);
+	_size += entrySize(entry);
+}
+
+void ThemeDrawCache::clear() {
+	while (_lruHead)
+		removeEntry(_lruHead);
+
+	assert(_size == 0 && _entries.empty());
+}
+
+bool ThemeDrawCache::isCacheable(const Common::Rect &r, const Graphics::PixelFormat &format) const {
+	const uint32 area = (uint32)r.width() * r.height();
+	if (r.isEmpty() || area < kMinCachedArea)
+		return false;
+
+	// Cache entries hold both the background and the drawing. Don't let a
+	// single widget take more than a quarter of the cache.
+	return area * format.bytesPerPixel * 2 <= _maxSize / 4;
+}
+
+void ThemeDrawCache::removeEntry(Entry *entry) {
+	_size -= entrySize(entry);
+	_entries.erase(entry->key);
+	unlinkEntry(entry);
+
+	entry->background->free();
+	delete entry->background;
+	entry->drawing.free();
+	delete entry;
+}
+
+void ThemeDrawCache::evict(uint32 size) {
+	while (_lruTail && _size + size > _maxSize)
+		removeEntry(_lruTail);
+}
+
+void ThemeDrawCache::linkEntry(Entry *entry) {
+	entry->prev = 0;
+	entry->next = _lruHead;
+	if (_lruHead)
+		_lruHead->prev = entry;
+	else
+		_lruTail = entry;
+	_lruHead = entry;
+}
+
+void ThemeDrawCache::unlinkEntry(Entry *entry) {
+	if (entry->prev)
+		entry->prev->next = entry->next;
+	else
+		_lruHead = entry->next;
+
+	if (entry->next)
+		entry->next->prev = entry->prev;
+	else
+		_lruTail = entry->prev;
+}
+
+uint32 ThemeDrawCache::entrySize(const Entry *entry) {
+	return entry->drawing.h * entry->drawing.pitch + entry->background->h * entry->background->pitch;
+}
+
+uint ThemeDrawCache::KeyHash::operator()(const Key &key) const {
+	uint hash = (uint)(size_t)key.data;
+	hash = hash * 31 + key.dynamicData;
+	hash = hash * 31 + ((key.width << 16) | (uint16)key.height);
+	hash = hash * 31 + ((key.rect.left << 16) | (uint16)key.rect.top);
+	hash = hash * 31 + ((key.rect.right << 16) | (uint16)key.rect.bottom);
+	hash = hash * 31 + key.colors.fg;
+	hash = hash * 31 + key.colors.bg;
+	hash = hash * 31 + key.colors.bevel;
+	hash = hash * 31 + key.colors.gradientStart;
+	hash = hash * 31 + key.colors.gradientEnd;
+	hash = hash * 31 + key.shadows;
+	return hash;
+}
+
+bool ThemeDrawCache::KeyEqualTo::operator()(const Key &a, const Key &b) const {
+	return a.data == b.data && a.dynamicData == b.dynamicData
+	    && a.width == b.width && a.height == b.height && a.rect == b.rect
+	    && a.colors.fg == b.colors.fg && a.colors.bg == b.colors.bg
+	    && a.colors.bevel == b.colors.bevel
+	    && a.colors.gradientStart == b.colors.gradientStart
+	    && a.colors.gradientEnd == b.colors.gradientEnd
+	    && a.shadows == b.shadows;
+}
+
+} // End of namespace GUI
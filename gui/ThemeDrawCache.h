@@ -0,0 +1,139 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GUI_THEME_DRAW_CACHE_H
+#define GUI_THEME_DRAW_CACHE_H
+
+#include "common/scummsys.h"
+#include "common/hashmap.h"
+#include "common/rect.h"
+
+#include "graphics/surface.h"
+#include "graphics/VectorRenderer.h"
+
+namespace GUI {
+
+/**
+ * Cache of rasterized DrawData items.
+ *
+ * Rendering the draw steps of a widget (gradients, anti-aliased rounded
+ * corners, shadows...) is costly, yet most widgets get drawn over and over
+ * again with the same size and state. This cache keeps the pixels resulting
+ * from drawing a widget, together with the pixels which were below it, so
+ * that drawing the same widget on top of the same background can be done
+ * with a plain copy.
+ *
+ * There is a single entry per key, holding the last background the item was
+ * drawn on. Entries are evicted in least recently used order once the total
+ * size of the cached pixels exceeds the configured limit.
+ */
+class ThemeDrawCache {
+public:
+	/**
+	 * Identifies a drawing of a DrawData item. Everything which has an
+	 * influence on the resulting pixels except for the background pixels
+	 * themselves has to be part of the key. The background is compared
+	 * when the entry is restored.
+	 */
+	struct Key {
+		const void *data;        ///< The drawn WidgetDrawData
+		uint32 dynamicData;      ///< Dynamic data passed to the draw steps
+		int16 width, height;     ///< Size of the widget area
+		Common::Rect rect;       ///< Cached rect, relative to the widget area
+		Graphics::VectorRenderer::ColorState colors;
+		bool shadows;
+	};
+
+	ThemeDrawCache(uint32 maxSize);
+	~ThemeDrawCache();
+
+	/**
+	 * Copies the cached drawing for the given key into the given area of
+	 * the surface, provided the pixels currently in that area match the
+	 * background the cached drawing was done on.
+	 *
+	 * @return true if the cached drawing was used.
+	 */
+	bool restore(const Key &key, Graphics::Surface *surface, const Common::Rect &r);
+
+	/**
+	 * Adds the drawing found in the given area of the surface to the cache.
+	 * The cache takes ownership of the background surface, which has to
+	 * hold the pixels which were in that area before drawing.
+	 */
+	void store(const Key &key, Graphics::Surface *background, const Graphics::Surface *surface, const Common::Rect &r);
+
+	/**
+	 * Removes all entries from the cache. Has to be called whenever the
+	 * DrawData items or the format of the drawing surfaces change.
+	 */
+	void clear();
+
+	/**
+	 * Returns whether drawings of the given size are worth caching.
+	 */
+	bool isCacheable(const Common::Rect &r, const Graphics::PixelFormat &format) const;
+
+private:
+	enum {
+		/**
+		 * Smaller drawings are cheaper to draw again than to compare
+		 * their background and copy them.
+		 */
+		kMinCachedArea = 32 * 16
+	};
+
+	struct Entry {
+		Key key;
+		Graphics::Surface *background;
+		Graphics::Surface drawing;
+		Entry *prev, *next;      ///< Neighbours in the LRU list, most recently used first
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &key) const;
+	};
+
+	struct KeyEqualTo {
+		bool operator()(const Key &a, const Key &b) const;
+	};
+
+	typedef Common::HashMap<Key, Entry *, KeyHash, KeyEqualTo> EntryMap;
+
+	void removeEntry(Entry *entry);
+	void evict(uint32 size);
+
+	void linkEntry(Entry *entry);
+	void unlinkEntry(Entry *entry);
+
+	static uint32 entrySize(const Entry *entry);
+
+	EntryMap _entries;
+	Entry *_lruHead;
+	Entry *_lruTail;
+	uint32 _size;
+	uint32 _maxSize;
+};
+
+} // End of namespace GUI
+
+#endif
@@ -24,6 +24,8 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
 #include "common/unzip.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
@@ -38,6 +40,7 @@
 
 #include "gui/widget.h"
 #include "gui/ThemeEngine.h"
+#include "gui/ThemeDrawCache.h"
 #include "gui/ThemeEval.h"
 #include "gui/ThemeParser.h"
 
@@ -75,6 +78,9 @@ struct WidgetDrawData {
 
 	bool _buffer;
 
+	/** Whether drawings of this widget can be reused by the draw cache.
+	    Set by calcBackgroundOffset() */
+	bool _cacheable;
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -82,6 +88,7 @@ struct WidgetDrawData {
 	 * called in order to calculate if such draw steps would be drawn outside of
 	 * the actual widget drawing zone (e.g. shadows). If this is the case, a constant
 	 * value will be added when restoring the background of the widget.
+	 * It also determines whether drawings of the widget may be cached.
 	 */
 	void calcBackgroundOffset();
 };
@@ -223,11 +230,8 @@ void ThemeItemDrawData::drawSelf(bool draw, bool restore) {
 	if (restore)
 		_engine->restoreBackground(extendedRect);
 
-	if (draw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = _data->_steps.begin(); step != _data->_steps.end(); ++step)
-			_engine->renderer()->drawStep(_area, *step, _dynamicData);
-	}
+	if (draw)
+		_engine->drawDDSteps(*_data, _area, extendedRect, _dynamicData);
 
 	_engine->addDirtyRect(extendedRect);
 }
@@ -272,6 +276,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system = g_system;
 	_parser = new ThemeParser(this);
 	_themeEval = new GUI::ThemeEval();
+	_drawCache = new GUI::ThemeDrawCache(kDrawCacheSize);
 
 	_useCursor = false;
 
@@ -325,6 +330,7 @@ ThemeEngine::~ThemeEngine() {
 
 	delete _parser;
 	delete _themeEval;
+	delete _drawCache;
 	delete[] _cursor;
 }
 
@@ -515,10 +521,15 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	delete _vectorRenderer;
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
+
+	// Cached drawings are in the format of the old surfaces
+	_drawCache->clear();
 }
 
 void WidgetDrawData::calcBackgroundOffset() {
 	uint maxShadow = 0;
+	_cacheable = !_steps.empty();
+
 	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
 	        step != _steps.end(); ++step) {
 		if ((step->autoWidth || step->autoHeight) && step->shadow > maxShadow)
@@ -526,6 +537,10 @@ void WidgetDrawData::calcBackgroundOffset() {
 
 		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_BEVELSQ && step->bevel > maxShadow)
 			maxShadow = step->bevel;
+
+		// Filling the whole surface reaches way outside the widget area
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_FILLSURFACE)
+			_cacheable = false;
 	}
 
 	_backgroundOffset = maxShadow;
@@ -536,6 +551,49 @@ void ThemeEngine::restoreBackground(Common::Rect r) {
 	_vectorRenderer->blitSurface(&_backBuffer, r);
 }
 
+void ThemeEngine::drawDDSteps(const WidgetDrawData &data, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamicData) {
+	Graphics::Surface *surface = _vectorRenderer->getActiveSurface();
+
+	Common::Rect r = extendedRect;
+	r.clip(surface->w, surface->h);
+
+	if (!data._cacheable || !_drawCache->isCacheable(r, surface->format)) {
+		Common::List<Graphics::DrawStep>::const_iterator step;
+		for (step = data._steps.begin(); step != data._steps.end(); ++step)
+			_vectorRenderer->drawStep(area, *step, dynamicData);
+		return;
+	}
+
+	GUI::ThemeDrawCache::Key key;
+	key.data = &data;
+	key.dynamicData = dynamicData;
+	key.width = area.width();
+	key.height = area.height();
+	key.rect = r;
+	key.rect.translate(-area.left, -area.top);
+	key.colors = _vectorRenderer->getColorState();
+	key.shadows = !_vectorRenderer->shadowsDisabled();
+
+	if (_drawCache->restore(key, surface, r)) {
+		// Leave the renderer in the state drawing the steps would have
+		Common::List<Graphics::DrawStep>::const_iterator step;
+		for (step = data._steps.begin(); step != data._steps.end(); ++step)
+			_vectorRenderer->applyStepState(*step, dynamicData);
+		return;
+	}
+
+	Graphics::Surface *background = new Graphics::Surface();
+	background->create(r.width(), r.height(), surface->format);
+	for (int y = 0; y < r.height(); ++y)
+		memcpy(background->getBasePtr(0, y), surface->getBasePtr(r.left, r.top + y), r.width() * surface->format.bytesPerPixel);
+
+	Common::List<Graphics::DrawStep>::const_iterator step;
+	for (step = data._steps.begin(); step != data._steps.end(); ++step)
+		_vectorRenderer->drawStep(area, *step, dynamicData);
+
+	_drawCache->store(key, background, surface, r);
+}
+
 
 
 /**********************************************************
@@ -661,6 +719,7 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
 	_widgets[id] = new WidgetDrawData;
 	_widgets[id]->_buffer = kDrawDataDefaults[id].buffer;
 	_widgets[id]->_textDataId = kTextDataNone;
+	_widgets[id]->_cacheable = false;
 
 	return true;
 }
@@ -699,6 +758,13 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearThemeData();
+}
+
+void ThemeEngine::clearThemeData() {
+	// Cached drawings refer to the DrawData items freed below
+	_drawCache->clear();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -729,16 +795,29 @@ bool ThemeEngine::loadDefaultXML() {
 #include "themes/default.inc"
 	    ;
 
-	if (!_parser->loadBuffer((const byte *)defaultXML, strlen(defaultXML)))
-		return false;
+	const uint32 defaultXMLSize = strlen(defaultXML);
+	Common::MemoryReadStream defaultXMLStream((const byte *)defaultXML, defaultXMLSize);
+	const Common::String fingerprint = Common::computeStreamMD5AsString(defaultXMLStream);
 
 	_themeName = "ScummVM Classic Theme (Builtin Version)";
 	_themeId = "builtin";
 	_themeFile.clear();
 
+	if (loadThemeCache(_themeId, fingerprint))
+		return true;
+
+	if (!_parser->loadBuffer((const byte *)defaultXML, defaultXMLSize))
+		return false;
+
+	Common::MemoryWriteStreamDynamic keys(DisposeAfterUse::YES);
+	_parser->setRecordStream(&keys);
 	bool result = _parser->parse();
+	_parser->setRecordStream(0);
 	_parser->close();
 
+	if (result)
+		createThemeCache(_themeId, fingerprint, keys);
+
 	return result;
 #else
 	warning("The built-in theme is not enabled in the current build. Please load an external theme");
@@ -775,20 +854,44 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		return false;
 	}
 
+	//
+	// Checksum all STX files, so we can tell whether the theme cache
+	// is up to date
+	//
+	Common::String fingerprint;
+	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
+		Common::SeekableReadStream *stream = (*i)->createReadStream();
+		if (!stream) {
+			warning("Failed to load STX file '%s'", (*i)->getDisplayName().c_str());
+			return false;
+		}
+
+		fingerprint += (*i)->getName() + ":" + Common::computeStreamMD5AsString(*stream) + ";";
+		delete stream;
+	}
+
+	if (loadThemeCache(themeId, fingerprint))
+		return true;
+
 	//
 	// Loop over all STX files, load and parse them
 	//
+	Common::MemoryWriteStreamDynamic keys(DisposeAfterUse::YES);
+	_parser->setRecordStream(&keys);
+
 	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
 		assert((*i)->getName().hasSuffix(".stx"));
 
 		if (_parser->loadStream((*i)->createReadStream()) == false) {
 			warning("Failed to load STX file '%s'", (*i)->getDisplayName().c_str());
+			_parser->setRecordStream(0);
 			_parser->close();
 			return false;
 		}
 
 		if (_parser->parse() == false) {
 			warning("Failed to parse STX file '%s'", (*i)->getDisplayName().c_str());
+			_parser->setRecordStream(0);
 			_parser->close();
 			return false;
 		}
@@ -796,10 +899,91 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		_parser->close();
 	}
 
+	_parser->setRecordStream(0);
+	createThemeCache(themeId, fingerprint, keys);
+
 	assert(!_themeName.empty());
 	return true;
 }
 
+#define THEME_CACHE_TAG MKTAG('S', 'T', 'X', 'C')
+#define THEME_CACHE_VERSION 1
+
+bool ThemeEngine::loadThemeCache(const Common::String &themeId, const Common::String &fingerprint) {
+	const Common::String cacheFilename(genThemeCacheFilename(themeId));
+
+	Common::ArchiveMemberList members;
+	_themeFiles.listMatchingMembers(members, cacheFilename);
+	if (members.empty())
+		return false;
+
+	Common::SeekableReadStream *stream = members.front()->createReadStream();
+	if (!stream)
+		return false;
+
+	bool valid = (stream->readUint32BE() == THEME_CACHE_TAG && stream->readUint32BE() == THEME_CACHE_VERSION);
+
+	const uint32 fingerprintSize = valid ? stream->readUint32BE() : 0;
+	valid = valid && !stream->err() && fingerprintSize == fingerprint.size();
+
+	if (valid) {
+		// Compare the fingerprint piece by piece, it is plain ASCII
+		for (uint32 i = 0; i < fingerprintSize && valid; ++i)
+			valid = ((char)stream->readByte() == fingerprint[i]);
+	}
+
+	const uint32 keysSize = valid ? stream->readUint32BE() : 0;
+	const int32 remaining = stream->size() - stream->pos();
+	byte *keys = 0;
+	if (valid && !stream->err() && remaining >= 0 && keysSize <= (uint32)remaining) {
+		keys = (byte *)malloc(keysSize);
+		if (keys && stream->read(keys, keysSize) != keysSize) {
+			free(keys);
+			keys = 0;
+		}
+	}
+
+	delete stream;
+
+	if (!keys) {
+		debug(3, "Theme cache '%s' is outdated", cacheFilename.c_str());
+		return false;
+	}
+
+	Common::MemoryReadStream keyStream(keys, keysSize, DisposeAfterUse::YES);
+	if (!_parser->replay(keyStream)) {
+		warning("Failed to load theme cache '%s'", cacheFilename.c_str());
+		clearThemeData();
+		return false;
+	}
+
+	debug(6, "Loaded theme %s from cache", themeId.c_str());
+	return true;
+}
+
+bool ThemeEngine::createThemeCache(const Common::String &themeId, const Common::String &fingerprint, Common::MemoryWriteStreamDynamic &keys) {
+	const Common::String cacheFilename(genThemeCacheFilename(themeId));
+
+	Common::DumpFile cacheFile;
+	if (!cacheFile.open(cacheFilename)) {
+		debug(3, "Couldn't open theme cache '%s' for writing", cacheFilename.c_str());
+		return false;
+	}
+
+	cacheFile.writeUint32BE(THEME_CACHE_TAG);
+	cacheFile.writeUint32BE(THEME_CACHE_VERSION);
+	cacheFile.writeUint32BE(fingerprint.size());
+	cacheFile.write(fingerprint.c_str(), fingerprint.size());
+	cacheFile.writeUint32BE(keys.size());
+	cacheFile.write(keys.getData(), keys.size());
+
+	return !cacheFile.err();
+}
+
+Common::String ThemeEngine::genThemeCacheFilename(const Common::String &themeId) const {
+	return themeId + ".tcc";
+}
+
 
 
 /**********************************************************
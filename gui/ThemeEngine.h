@@ -41,6 +41,7 @@ class OSystem;
 
 namespace Common {
 struct Rect;
+class MemoryWriteStreamDynamic;
 }
 
 namespace Graphics {
@@ -55,6 +56,7 @@ struct TextDrawData;
 struct TextColorData;
 class Dialog;
 class GuiObject;
+class ThemeDrawCache;
 class ThemeEval;
 class ThemeItem;
 class ThemeParser;
@@ -249,6 +251,9 @@ public:
 	/** Constant value to expand dirty rectangles, to make sure they are fully copied */
 	static const int kDirtyRectangleThreshold = 1;
 
+	/** Maximum amount of memory used to cache rasterized DrawData items */
+	static const uint32 kDrawCacheSize = 2 * 1024 * 1024;
+
 	struct Renderer {
 		const char *name;
 		const char *shortname;
@@ -513,6 +518,17 @@ public:
 	 */
 	void restoreBackground(Common::Rect r);
 
+	/**
+	 * Runs all draw steps of a DrawData item, reusing a previous drawing
+	 * of the same item on the same background when possible.
+	 *
+	 * @param data DrawData item to draw.
+	 * @param area Area of the widget.
+	 * @param extendedRect Area touched by the draw steps.
+	 * @param dynamicData Dynamic data passed to the draw steps.
+	 */
+	void drawDDSteps(const WidgetDrawData &data, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamicData);
+
 	const Common::String &getThemeName() const { return _themeName; }
 	const Common::String &getThemeId() const { return _themeId; }
 	int getGraphicsMode() const { return _graphicsMode; }
@@ -543,12 +559,36 @@ protected:
 	 */
 	bool loadDefaultXML();
 
+	/**
+	 * Loads the theme from its precompiled cache file, which holds the
+	 * recorded keys of all the theme's XML files. The cache is only used
+	 * when it was created from XML sources matching the given fingerprint.
+	 *
+	 * @param themeId Theme identifier.
+	 * @param fingerprint Checksum of the theme's XML sources.
+	 * @returns true if the theme was successfully loaded from the cache.
+	 */
+	bool loadThemeCache(const Common::String &themeId, const Common::String &fingerprint);
+
+	/**
+	 * Stores the keys recorded while parsing the theme's XML files into
+	 * the theme cache file, so the next load can skip the XML parsing.
+	 */
+	bool createThemeCache(const Common::String &themeId, const Common::String &fingerprint, Common::MemoryWriteStreamDynamic &keys);
+
+	Common::String genThemeCacheFilename(const Common::String &themeId) const;
+
 	/**
 	 * Unloads the currently loaded theme so another one can
 	 * be loaded.
 	 */
 	void unloadTheme();
 
+	/**
+	 * Frees all draw data, fonts and layouts set up by the theme parser.
+	 */
+	void clearThemeData();
+
 	const Graphics::Font *loadScalableFont(const Common::String &filename, const Common::String &charset, const int pointsize, Common::String &name);
 	const Graphics::Font *loadFont(const Common::String &filename, Common::String &name);
 	Common::String genCacheFilename(const Common::String &filename) const;
@@ -616,6 +656,9 @@ protected:
 	/** Theme getEvaluator (changed from GUI::Eval to add functionality) */
 	GUI::ThemeEval *_themeEval;
 
+	/** Rasterized DrawData items, reused when redrawing identical widgets */
+	GUI::ThemeDrawCache *_drawCache;
+
 	/** Main screen surface. This is blitted straight into the overlay. */
 	Graphics::Surface _screen;
 
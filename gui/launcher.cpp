@@ -21,6 +21,7 @@
 
 #include "base/version.h"
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/events.h"
 #include "common/fs.h"
@@ -722,6 +723,27 @@ void LauncherDialog::close() {
 	Dialog::close();
 }
 
+namespace {
+
+struct LauncherEntry {
+	Common::String description;
+	Common::String target;
+
+	LauncherEntry(const Common::String &d, const Common::String &t) : description(d), target(t) {}
+};
+
+struct LauncherEntryLess {
+	bool operator()(const LauncherEntry &x, const LauncherEntry &y) const {
+		const int cmp = scumm_stricmp(x.description.c_str(), y.description.c_str());
+		if (cmp != 0)
+			return cmp < 0;
+		// Keep entries with the same description in a stable order
+		return scumm_stricmp(x.target.c_str(), y.target.c_str()) < 0;
+	}
+};
+
+} // End of anonymous namespace
+
 void LauncherDialog::updateListing() {
 	StringArray l;
 
@@ -729,6 +751,9 @@ void LauncherDialog::updateListing() {
 	_domains.clear();
 	const ConfigManager::DomainMap &domains = ConfMan.getGameDomains();
 	ConfigManager::DomainMap::const_iterator iter;
+
+	Common::Array<LauncherEntry> entries;
+	entries.reserve(domains.size());
 	for (iter = domains.begin(); iter != domains.end(); ++iter) {
 #ifdef __DS__
 		// DS port uses an extra section called 'ds'.  This prevents the section from being
@@ -753,15 +778,19 @@ void LauncherDialog::updateListing() {
 			description = Common::String::format("Unknown (target %s, gameid %s)", iter->_key.c_str(), gameid.c_str());
 		}
 
-		if (!gameid.empty() && !description.empty()) {
-			// Insert the game into the launcher list
-			int pos = 0, size = l.size();
+		if (!gameid.empty() && !description.empty())
+			entries.push_back(LauncherEntry(description, iter->_key));
+	}
 
-			while (pos < size && (scumm_stricmp(description.c_str(), l[pos].c_str()) > 0))
-				pos++;
-			l.insert_at(pos, description);
-			_domains.insert_at(pos, iter->_key);
-		}
+	// Sort all games at once, inserting them one by one into sorted lists
+	// takes quadratic time, which hurts with large game libraries.
+	Common::sort(entries.begin(), entries.end(), LauncherEntryLess());
+
+	l.reserve(entries.size());
+	_domains.reserve(entries.size());
+	for (Common::Array<LauncherEntry>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+		l.push_back(i->description);
+		_domains.push_back(i->target);
 	}
 
 	const int oldSel = _list->getSelected();
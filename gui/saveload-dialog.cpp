@@ -22,6 +22,7 @@
 #include "gui/saveload-dialog.h"
 #include "common/translation.h"
 #include "common/config-manager.h"
+#include "common/system.h"
 
 #include "gui/message.h"
 #include "gui/gui-manager.h"
@@ -534,9 +535,18 @@ enum {
 	kNewSaveCmd = 'SAVE'
 };
 
+enum {
+	// Upper bound (in milliseconds) we want to spend loading save meta
+	// infos in handleTickle.
+	kMaxMetaInfoLoadTime = 20,
+
+	// Minimum number of save slots whose meta infos are kept in memory.
+	kMetaInfoCacheSize = 64
+};
+
 SaveLoadChooserGrid::SaveLoadChooserGrid(const Common::String &title, bool saveMode)
 	: SaveLoadChooserDialog("SaveLoadChooser", saveMode), _lines(0), _columns(0), _entriesPerPage(0),
-	_curPage(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons() {
+	_curPage(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons(), _metaInfoUseCounter(0) {
 	_backgroundType = ThemeEngine::kDialogBackgroundSpecial;
 
 	new StaticTextWidget(this, "SaveLoadChooser.Title", title);
@@ -616,11 +626,19 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 	}
 }
 
+void SaveLoadChooserGrid::handleTickle() {
+	if (loadPendingMetaInfos())
+		drawDialog();
+
+	SaveLoadChooserDialog::handleTickle();
+}
+
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
 	_saveList = _metaEngine->listSaves(_target.c_str());
 	_resultString.clear();
+	_metaInfoCache.clear();
 
 	// Load information to restore the last page the user had open.
 	assert(_entriesPerPage != 0);
@@ -849,53 +867,25 @@ void SaveLoadChooserGrid::updateSaves() {
 	hideButtons();
 
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
+		const int saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
-
-		Common::String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
-
-		if (_saveDateSupport) {
-			const Common::String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += "\n";
-				tooltip +=  _("Date: ") + saveDate;
-			}
-
-			const Common::String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Time: ") + saveTime;
-			}
-		}
 
-		if (_playTimeSupport) {
-			const Common::String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Playtime: ") + playTime;
-			}
+		const SaveStateDescriptor *desc = getCachedMetaInfo(saveSlot);
+		if (desc) {
+			updateSlotButton(curButton, *desc);
+			continue;
 		}
 
-		curButton.button->setTooltip(tooltip);
+		// Show what the save list tells us until handleTickle has loaded
+		// the meta infos of this slot.
+		curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, _saveList[i].getDescription().c_str()));
+		curButton.button->setTooltip(_("Name: ") + _saveList[i].getDescription());
 
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		if (_saveMode && desc.getWriteProtectedFlag()) {
-			curButton.button->setEnabled(false);
-		} else {
-			curButton.button->setEnabled(true);
-		}
+		// We do not know yet whether the slot is write protected.
+		curButton.button->setEnabled(!_saveMode);
 	}
 
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
@@ -912,6 +902,117 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSlotButton(SlotButton &button, const SaveStateDescriptor &desc) {
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		button.button->setGfx(thumbnail);
+	} else {
+		button.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	button.description->setLabel(Common::String::format("%d. %s", desc.getSaveSlot(), desc.getDescription().c_str()));
+
+	Common::String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += "\n";
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	button.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected.
+	// TODO: Maybe we should not display it at all then?
+	if (_saveMode && desc.getWriteProtectedFlag()) {
+		button.button->setEnabled(false);
+	} else {
+		button.button->setEnabled(true);
+	}
+}
+
+const SaveStateDescriptor *SaveLoadChooserGrid::getCachedMetaInfo(int slot) {
+	MetaInfoCache::iterator i = _metaInfoCache.find(slot);
+	if (i == _metaInfoCache.end())
+		return 0;
+
+	i->_value.lastUse = ++_metaInfoUseCounter;
+	return &i->_value.desc;
+}
+
+const SaveStateDescriptor &SaveLoadChooserGrid::cacheMetaInfo(int slot) {
+	// Keep at least the current page and the pages around it.
+	const uint maxEntries = MAX<uint>(kMetaInfoCacheSize, 3 * _entriesPerPage);
+
+	while (_metaInfoCache.size() >= maxEntries) {
+		MetaInfoCache::iterator oldest = _metaInfoCache.begin();
+		for (MetaInfoCache::iterator i = _metaInfoCache.begin(); i != _metaInfoCache.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+
+		_metaInfoCache.erase(oldest);
+	}
+
+	CachedMetaInfo &entry = _metaInfoCache[slot];
+	entry.desc = _metaEngine->querySaveMetaInfos(_target.c_str(), slot);
+	// Descriptors returned for unreadable saves carry no slot number.
+	entry.desc.setSaveSlot(slot);
+	entry.lastUse = ++_metaInfoUseCounter;
+	return entry.desc;
+}
+
+bool SaveLoadChooserGrid::loadPendingMetaInfos() {
+	if (_entriesPerPage == 0 || _buttons.empty())
+		return false;
+
+	const uint32 startTime = g_system->getMillis();
+	bool updated = false;
+
+	// First fill in the buttons on the current page, then prefetch the
+	// next and the previous page.
+	const uint pages[] = { _curPage, _curPage + 1, _curPage - 1 };
+	for (uint p = 0; p < ARRAYSIZE(pages); ++p) {
+		const uint page = pages[p];
+		if (page == _curPage - 1 && _curPage == 0)
+			continue;
+
+		for (uint i = page * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
+			const int saveSlot = _saveList[i].getSaveSlot();
+			if (_metaInfoCache.contains(saveSlot))
+				continue;
+
+			if (g_system->getMillis() - startTime >= kMaxMetaInfoLoadTime)
+				return updated;
+
+			const SaveStateDescriptor &desc = cacheMetaInfo(saveSlot);
+
+			if (page == _curPage) {
+				updateSlotButton(_buttons[curNum], desc);
+				updated = true;
+			}
+		}
+	}
+
+	return updated;
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
@@ -163,6 +163,7 @@ public:
 protected:
 	virtual void handleCommand(CommandSender *sender, uint32 cmd, uint32 data);
 	virtual void handleMouseWheel(int x, int y, int direction);
+	virtual void handleTickle();
 private:
 	virtual int runIntern();
 
@@ -200,6 +201,27 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+	void updateSlotButton(SlotButton &button, const SaveStateDescriptor &desc);
+
+	/**
+	 * Meta infos of save slots already queried from the engine.
+	 *
+	 * Querying a save slot means opening the save file and decoding its
+	 * thumbnail, so slots are loaded a few at a time while the dialog is
+	 * idle and kept around for revisiting pages. The cache is dropped
+	 * whenever the dialog is opened, since saves may have changed since.
+	 */
+	struct CachedMetaInfo {
+		SaveStateDescriptor desc;
+		uint32 lastUse;
+	};
+	typedef Common::HashMap<int, CachedMetaInfo> MetaInfoCache;
+	MetaInfoCache _metaInfoCache;
+	uint32 _metaInfoUseCounter;
+
+	const SaveStateDescriptor *getCachedMetaInfo(int slot);
+	const SaveStateDescriptor &cacheMetaInfo(int slot);
+	bool loadPendingMetaInfos();
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -0,0 +1,186 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/spritecache.h"
+
+class SpriteCacheTestSuite : public CxxTest::TestSuite
+{
+	static Graphics::PixelFormat getFormat(int bpp) {
+		if (bpp == 1)
+			return Graphics::PixelFormat::createFormatCLUT8();
+		else if (bpp == 2)
+			return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		else
+			return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
+	}
+
+	static uint32 getColor(int bpp, char c) {
+		const uint32 color = c == '.' ? 0 : c - '0';
+		if (bpp == 1)
+			return color;
+		else if (bpp == 2)
+			return color * 0x1111;
+		else
+			return color * 0x11111111;
+	}
+
+	static uint32 getPixel(const Graphics::Surface &surface, int x, int y) {
+		if (surface.format.bytesPerPixel == 1)
+			return *(const uint8 *)surface.getBasePtr(x, y);
+		else if (surface.format.bytesPerPixel == 2)
+			return *(const uint16 *)surface.getBasePtr(x, y);
+		else
+			return *(const uint32 *)surface.getBasePtr(x, y);
+	}
+
+	static void fillSurface(Graphics::Surface &surface, const char *rows) {
+		const int bpp = surface.format.bytesPerPixel;
+		for (int y = 0; y < surface.h; y++) {
+			for (int x = 0; x < surface.w; x++) {
+				const uint32 color = getColor(bpp, rows[y * surface.w + x]);
+				if (bpp == 1)
+					*(uint8 *)surface.getBasePtr(x, y) = color;
+				else if (bpp == 2)
+					*(uint16 *)surface.getBasePtr(x, y) = color;
+				else
+					*(uint32 *)surface.getBasePtr(x, y) = color;
+			}
+		}
+	}
+
+	static bool checkSurface(const Graphics::Surface &surface, const char *rows) {
+		bool result = true;
+		for (int y = 0; y < surface.h; y++) {
+			for (int x = 0; x < surface.w; x++) {
+				if (getPixel(surface, x, y) != getColor(surface.format.bytesPerPixel, rows[y * surface.w + x]))
+					result = false;
+			}
+		}
+		return result;
+	}
+
+	public:
+	void test_blit() {
+		for (int bpp = 1; bpp <= 4; bpp *= 2) {
+			Graphics::Surface src;
+			src.create(4, 3, getFormat(bpp));
+			fillSurface(src,
+				"1..2"
+				"...."
+				".33.");
+
+			Graphics::CachedSprite sprite(src, getColor(bpp, '.'));
+			src.free();
+
+			Graphics::Surface dst;
+			dst.create(6, 4, getFormat(bpp));
+			fillSurface(dst,
+				"999999"
+				"999999"
+				"999999"
+				"999999");
+
+			sprite.blit(dst, 1, 1);
+			TS_ASSERT(checkSurface(dst,
+				"999999"
+				"919929"
+				"999999"
+				"993399"));
+
+			dst.free();
+		}
+	}
+
+	void test_blit_clipped() {
+		for (int bpp = 1; bpp <= 4; bpp *= 2) {
+			Graphics::Surface src;
+			src.create(2, 2, getFormat(bpp));
+			fillSurface(src,
+				"12"
+				"34");
+
+			Graphics::CachedSprite sprite(src, getColor(bpp, '.'));
+			src.free();
+
+			Graphics::Surface dst;
+			dst.create(2, 2, getFormat(bpp));
+			fillSurface(dst,
+				"99"
+				"99");
+
+			sprite.blit(dst, -1, 1);
+			TS_ASSERT(checkSurface(dst,
+				"99"
+				"29"));
+
+			// Completely outside
+			sprite.blit(dst, 5, -5);
+			TS_ASSERT(checkSurface(dst,
+				"99"
+				"29"));
+
+			dst.free();
+		}
+	}
+
+	void test_transparent_color() {
+		// The whole pixel has to be compared, not only its first byte
+		for (int bpp = 2; bpp <= 4; bpp *= 2) {
+			Graphics::Surface src;
+			src.create(2, 1, getFormat(bpp));
+			fillSurface(src, "..");
+			if (bpp == 2)
+				*(uint16 *)src.getBasePtr(0, 0) = 0x0100;
+			else
+				*(uint32 *)src.getBasePtr(0, 0) = 0x01000000;
+
+			Graphics::CachedSprite sprite(src, 0);
+			src.free();
+
+			Graphics::Surface dst;
+			dst.create(2, 1, getFormat(bpp));
+			fillSurface(dst, "99");
+
+			sprite.blit(dst, 0, 0);
+			TS_ASSERT_EQUALS(getPixel(dst, 0, 0), bpp == 2 ? (uint32)0x0100 : (uint32)0x01000000);
+			TS_ASSERT_EQUALS(getPixel(dst, 1, 0), getColor(bpp, '9'));
+
+			dst.free();
+		}
+	}
+
+	void test_cache_lru() {
+		Graphics::Surface src;
+		src.create(2, 2, Graphics::PixelFormat::createFormatCLUT8());
+		fillSurface(src, "1111");
+
+		uint32 spriteSize = Graphics::CachedSprite(src, 0).getSize();
+		Graphics::SpriteCache cache(spriteSize * 2);
+
+		TS_ASSERT(cache.find(1, 0) == 0);
+		const Graphics::CachedSprite *sprite = cache.add(1, 0, src, 0);
+		TS_ASSERT(sprite != 0);
+		TS_ASSERT(cache.find(1, 0) == sprite);
+		TS_ASSERT(cache.find(0, 1) == 0);
+		TS_ASSERT_EQUALS(cache.getSize(), spriteSize);
+
+		cache.add(1, 1, src, 0);
+		cache.find(1, 0);
+
+		// Sprite (1, 1) is the least recently used one
+		cache.add(2, 0, src, 0);
+		TS_ASSERT(cache.find(1, 0) != 0);
+		TS_ASSERT(cache.find(1, 1) == 0);
+		TS_ASSERT(cache.find(2, 0) != 0);
+		TS_ASSERT_EQUALS(cache.getSize(), spriteSize * 2);
+
+		cache.setMaxSize(spriteSize);
+		TS_ASSERT(cache.find(1, 0) == 0);
+		TS_ASSERT(cache.find(2, 0) != 0);
+
+		cache.remove(2, 0);
+		TS_ASSERT(cache.find(2, 0) == 0);
+		TS_ASSERT_EQUALS(cache.getSize(), (uint32)0);
+
+		src.free();
+	}
+};
@@ -0,0 +1,163 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/rect.h"
+#include "graphics/surface.h"
+
+class SurfaceTestSuite : public CxxTest::TestSuite
+{
+	static void fillSurface(Graphics::Surface &surface, const char *rows) {
+		for (int y = 0; y < surface.h; y++) {
+			for (int x = 0; x < surface.w; x++) {
+				const uint32 color = rows[y * surface.w + x] - '0';
+				if (surface.format.bytesPerPixel == 1)
+					*(uint8 *)surface.getBasePtr(x, y) = color;
+				else if (surface.format.bytesPerPixel == 2)
+					*(uint16 *)surface.getBasePtr(x, y) = color * 0x1111;
+				else
+					*(uint32 *)surface.getBasePtr(x, y) = color * 0x11111111;
+			}
+		}
+	}
+
+	static bool checkSurface(const Graphics::Surface &surface, const char *rows) {
+		Graphics::Surface expected;
+		expected.create(surface.w, surface.h, surface.format);
+		fillSurface(expected, rows);
+
+		bool result = true;
+		for (int y = 0; y < surface.h; y++) {
+			if (memcmp(surface.getBasePtr(0, y), expected.getBasePtr(0, y), surface.w * surface.format.bytesPerPixel))
+				result = false;
+		}
+
+		expected.free();
+		return result;
+	}
+
+	static Graphics::PixelFormat getFormat(int bpp) {
+		if (bpp == 1)
+			return Graphics::PixelFormat::createFormatCLUT8();
+		else if (bpp == 2)
+			return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		else
+			return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
+	}
+
+	public:
+	void test_transBlitFrom() {
+		for (int bpp = 1; bpp <= 4; bpp *= 2) {
+			Graphics::Surface src, dst;
+			src.create(3, 2, getFormat(bpp));
+			dst.create(4, 3, getFormat(bpp));
+
+			fillSurface(src,
+				"102"
+				"034");
+
+			fillSurface(dst,
+				"9999"
+				"9999"
+				"9999");
+			dst.transBlitFrom(src, 1, 1, 0);
+			TS_ASSERT(checkSurface(dst,
+				"9999"
+				"9192"
+				"9934"));
+
+			fillSurface(dst,
+				"9999"
+				"9999"
+				"9999");
+			dst.transBlitFrom(src, 0, 0, 0, true);
+			TS_ASSERT(checkSurface(dst,
+				"2919"
+				"4399"
+				"9999"));
+
+			src.free();
+			dst.free();
+		}
+	}
+
+	void test_transBlitFrom_clipped() {
+		Graphics::Surface src, dst;
+		src.create(3, 2, getFormat(1));
+		dst.create(2, 2, getFormat(1));
+
+		fillSurface(src,
+			"123"
+			"456");
+
+		fillSurface(dst,
+			"99"
+			"99");
+		dst.transBlitFrom(src, -1, 1, 0);
+		TS_ASSERT(checkSurface(dst,
+			"99"
+			"23"));
+
+		fillSurface(dst,
+			"99"
+			"99");
+		dst.transBlitFrom(src, -1, 1, 0, true);
+		TS_ASSERT(checkSurface(dst,
+			"99"
+			"21"));
+
+		fillSurface(dst,
+			"99"
+			"99");
+		dst.transBlitFrom(src, Common::Rect(1, 0, 3, 2), 0, 0, 0);
+		TS_ASSERT(checkSurface(dst,
+			"23"
+			"56"));
+
+		fillSurface(dst,
+			"99"
+			"99");
+		dst.transBlitFrom(src, 2, 0, 0);
+		dst.transBlitFrom(src, 0, -2, 0);
+		TS_ASSERT(checkSurface(dst,
+			"99"
+			"99"));
+
+		src.free();
+		dst.free();
+	}
+
+	void test_maskBlitFrom() {
+		for (int bpp = 1; bpp <= 4; bpp *= 2) {
+			Graphics::Surface src, mask, dst;
+			src.create(3, 2, getFormat(bpp));
+			mask.create(3, 2, getFormat(1));
+			dst.create(3, 2, getFormat(bpp));
+
+			fillSurface(src,
+				"123"
+				"456");
+			fillSurface(mask,
+				"101"
+				"010");
+
+			fillSurface(dst,
+				"999"
+				"999");
+			dst.maskBlitFrom(src, mask, 0, 0);
+			TS_ASSERT(checkSurface(dst,
+				"193"
+				"959"));
+
+			fillSurface(dst,
+				"999"
+				"999");
+			dst.maskBlitFrom(src, mask, 1, 0, true);
+			TS_ASSERT(checkSurface(dst,
+				"939"
+				"995"));
+
+			src.free();
+			mask.free();
+			dst.free();
+		}
+	}
+};